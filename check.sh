@@ -8,6 +8,26 @@
 #     CORE_MATH_CHECK_STD=true ./check.sh ...
 # (3) to check the GNU libc 2.27, installed in say /tmp/install:
 #     CORE_MATH_CHECK_STD=true CORE_MATH_LAUNCHER="/tmp/lib/ld-2.27.so --library-path /tmp/lib" LDFLAGS="-L /tmp/lib" ./check.sh --worst --rndn exp
+# (4) to keep the MPFR reference values of exhaustive checks in /data/golden
+#     (one 16 GiB sparse file per function and rounding mode, see
+#     src/binary32/support/check_exhaustive.c), so that the next exhaustive
+#     checks of the same function do not call MPFR:
+#     CORE_MATH_GOLDEN_DIR=/data/golden ./check.sh --exhaustive sinf
+# (5) to only call MPFR on the inputs where the function differs from its
+#     version in revision HEAD~, or where that version failed according to
+#     the checkpoints of a complete check of it kept in /data/checkpoints.old
+#     (see (6); a --worst check only records there that it passed the .wc
+#     file, and is differential only if the other version passed it); without
+#     such checkpoints, all the inputs are compared with MPFR:
+#     CORE_MATH_DIFF_REV=HEAD~ CORE_MATH_DIFF_FAILURES=/data/checkpoints.old ./check.sh --exhaustive sinf
+# (6) to split an exhaustive check into N shards, run for example by N
+#     processes or batch jobs (here the second of 4), and to record the
+#     progress in /data/checkpoints, so that a killed check can be restarted
+#     with the same command and resumes where it stopped:
+#     CORE_MATH_CHECKPOINT_DIR=/data/checkpoints ./check.sh --exhaustive --shard 2/4 sinf
+# (7) to compare the batch variant cr_sinf_n with cr_sinf on all the inputs
+#     (see src/binary32/support/check_exhaustive.c; MPFR is not called):
+#     ./check.sh --batch sinf
 
 if [ "`which gmake`" != "" ]; then
    MAKE=gmake
@@ -19,12 +39,17 @@ FUN="${!#}"
 ARGS=("${@:1:$#-1}")
 
 MODES=()
+SHARD=
 for i in "${!ARGS[@]}"; do
     case "${ARGS[i]}" in
         --rnd*)
             MODES+=("${ARGS[i]}")
             unset 'ARGS[i]'
             ;;
+        --shard)
+            # each shard has its own checkpoint, e.g. sinf.rndn.2of4
+            SHARD=".${ARGS[i+1]/\//of}"
+            ;;
     esac
 done
 if [[ "${#MODES[@]}" -eq 0 ]]; then
@@ -47,8 +72,19 @@ DIR="$TMP_DIR/toto/$(basename "$ORIG_DIR")"
 
 mkdir "$TMP_DIR/toto"
 cp -a "$ORIG_DIR" "$ORIG_DIR/../support" "$TMP_DIR/toto"
+# with the directories of other functions whose source is included (SOURCE_DIRS
+# in the Makefile, e.g. ../pow for pown)
+SOURCE_DIRS=($(sed -n 's/^SOURCE_DIRS := //p' "$ORIG_DIR/Makefile"))
+for d in "${SOURCE_DIRS[@]}"; do
+    cp -a "$ORIG_DIR/$d" "$TMP_DIR/toto"
+done
 cp -a "$ORIG_DIR/../../generic" "$TMP_DIR"
 
+# the C++ sources of the library need its headers and those of abseil (see
+# src/generic/support/Makefile.checkstd), which are not copied
+export CORE_MATH_INCLUDE="${CORE_MATH_INCLUDE:-$PWD/include}"
+export ABSEIL_INCLUDE="${ABSEIL_INCLUDE:-$PWD/deps/abseil-cpp/install/include}"
+
 if [ -n "${ARGS[0]}" ]; then
     KIND="${ARGS[0]}"
     unset 'ARGS[0]'
@@ -77,6 +113,38 @@ else
    export CFLAGS="$CFLAGS -DCORE_MATH_NO_OPENMP"
 fi
 
+# Extract the directory of the function (and the support directory next to
+# it) from revision $CORE_MATH_DIFF_REV, for the Makefile to link that
+# version too (see src/generic/support/Makefile.checkstd).
+setup_diff () {
+    if [[ -z "$CORE_MATH_DIFF_REV" || -n "$CORE_MATH_CHECK_STD" ]]; then
+        return
+    fi
+    if [ "$(uname -s)" = Darwin ]; then
+        # the Makefiles hide the symbols of the other version with objcopy
+        # --keep-global-symbol, which does not handle Mach-O objects
+        echo "The differential check is not supported on Darwin, running a full check"
+        return
+    fi
+    if ! git cat-file -e "$CORE_MATH_DIFF_REV:$FILE" 2> /dev/null; then
+        echo "$FUN not found in revision $CORE_MATH_DIFF_REV, running a full check"
+        return
+    fi
+    mkdir "$TMP_DIR/old"
+    # with the headers of that revision, for the C++ sources of the library
+    local INCLUDE=
+    if git cat-file -e "$CORE_MATH_DIFF_REV:include" 2> /dev/null; then
+        INCLUDE=include
+    fi
+    local d SOURCES=()
+    for d in "${SOURCE_DIRS[@]}"; do
+        SOURCES+=("$(dirname "$ORIG_DIR")/$(basename "$d")")
+    done
+    git archive "$CORE_MATH_DIFF_REV" "$ORIG_DIR" "$(dirname "$ORIG_DIR")/support" "${SOURCES[@]}" $INCLUDE | tar -x -C "$TMP_DIR/old"
+    export CORE_MATH_DIFF_DIR="$TMP_DIR/old/$ORIG_DIR"
+    echo "Differential check against revision $CORE_MATH_DIFF_REV"
+}
+
 has_symbol () {
     [ "$(nm "$LIBM" | while read a b c; do if [ "$c" = "$FUN" ]; then echo OK; return; fi; done | wc -l)" -ge 1 ]
 }
@@ -103,19 +171,63 @@ fi
 
 case "$KIND" in
     --exhaustive)
+        setup_diff
         "$MAKE" --quiet -C "$DIR" clean
         "$MAKE" $QUIET -C "$DIR" check_exhaustive
         for MODE in "${MODES[@]}"; do
             echo "Running exhaustive check in $MODE mode..."
-            $CORE_MATH_LAUNCHER "$DIR/check_exhaustive" "$MODE" "${ARGS[@]}"
+            GOLDEN=()
+            if [[ -n "$CORE_MATH_GOLDEN_DIR" && -z "$CORE_MATH_DIFF_DIR" ]]; then
+                mkdir -p "$CORE_MATH_GOLDEN_DIR"
+                GOLDEN=(--golden "$CORE_MATH_GOLDEN_DIR/$FUN.${MODE#--}")
+            fi
+            CHECKPOINT=()
+            if [[ -n "$CORE_MATH_CHECKPOINT_DIR" ]]; then
+                mkdir -p "$CORE_MATH_CHECKPOINT_DIR"
+                CHECKPOINT=(--checkpoint "$CORE_MATH_CHECKPOINT_DIR/$FUN.${MODE#--}$SHARD")
+            fi
+            # the failures of the other version, from the checkpoints of all
+            # the shards of its check: without them (or if that check was not
+            # complete) check_exhaustive compares all the inputs with MPFR
+            KNOWN=()
+            if [[ -n "$CORE_MATH_DIFF_DIR" ]]; then
+                cat "$CORE_MATH_DIFF_FAILURES/$FUN.${MODE#--}" "$CORE_MATH_DIFF_FAILURES/$FUN.${MODE#--}".*of* \
+                    > "$TMP_DIR/known.${MODE#--}" 2> /dev/null || true
+                KNOWN=(--known-failures "$TMP_DIR/known.${MODE#--}")
+            fi
+            $CORE_MATH_LAUNCHER "$DIR/check_exhaustive" "$MODE" "${GOLDEN[@]}" "${CHECKPOINT[@]}" "${KNOWN[@]}" "${ARGS[@]}"
+        done
+        ;;
+    --batch)
+        "$MAKE" --quiet -C "$DIR" clean
+        "$MAKE" $QUIET -C "$DIR" check_exhaustive
+        for MODE in "${MODES[@]}"; do
+            echo "Running batch check in $MODE mode..."
+            $CORE_MATH_LAUNCHER "$DIR/check_exhaustive" "$MODE" --batch "${ARGS[@]}"
         done
         ;;
     --worst)
+        setup_diff
         "$MAKE" --quiet -C "$DIR" clean
         OPENMP=$OPENMP "$MAKE" $QUIET -C "$DIR" check_worst
         for MODE in "${MODES[@]}"; do
             echo "Running worst cases check in $MODE mode..."
-            $CORE_MATH_LAUNCHER "$DIR/check_worst" "$MODE" "${ARGS[@]}" < "${FILE%.c}.wc"
+            # a check of the worst cases stops at the first failure, thus the
+            # other version is only trusted if it passed the same .wc file,
+            # as recorded in the checkpoint directory of its run
+            RECORD="$FUN.worst.${MODE#--}"
+            OTHER=()
+            if [[ -n "$CORE_MATH_DIFF_DIR" && -n "$CORE_MATH_DIFF_FAILURES" ]] &&
+                   cksum < "${FILE%.c}.wc" | cmp -s - "$CORE_MATH_DIFF_FAILURES/$RECORD"; then
+                OTHER=(--other-passed)
+            elif [[ -n "$CORE_MATH_DIFF_DIR" ]]; then
+                echo "No passing run of the other version on ${FILE%.c}.wc, checking all the inputs"
+            fi
+            $CORE_MATH_LAUNCHER "$DIR/check_worst" "$MODE" "${OTHER[@]}" "${ARGS[@]}" < "${FILE%.c}.wc" || exit 1
+            if [[ -n "$CORE_MATH_CHECKPOINT_DIR" ]]; then
+                mkdir -p "$CORE_MATH_CHECKPOINT_DIR"
+                cksum < "${FILE%.c}.wc" > "$CORE_MATH_CHECKPOINT_DIR/$RECORD"
+            fi
         done
         ;;
     --special)
@@ -11,14 +11,33 @@ fi
 
 # use the same order as on https://core-math.gitlabpages.inria.fr/
 FUNCTIONS_EXHAUSTIVE=(acosf acoshf acospif asinf asinhf asinpif atanf atanhf atanpif cbrtf cosf coshf cospif erff erfcf expf exp10f exp10m1f exp2f exp2m1f expm1f lgammaf logf log10f log10p1f log1pf log2f log2p1f rsqrtf sinf sinhf sinpif tanf tanhf tanpif tgammaf)
-FUNCTIONS_WORST=(acos acosh acospi asin asinh asinpi atan atan2 atan2f atan2pi atan2pif atanh atanpi cbrt cbrtl cos cosh cospi erf erfc exp exp10 exp10m1 exp2 exp2l exp2m1 hypot hypotf log log10 log10p1 log1p log2 log2p1 pow powf rsqrt sin sinh sinpi tan tanh tanpi)
+FUNCTIONS_WORST=(acos acosh acospi asin asinh asinpi atan atan2 atan2f atan2pi atan2pif atanh atanpi cbrt cbrtl cos cosh cospi erf erfc exp exp10 exp10m1 exp2 exp2l exp2m1 hypot hypotf log log10 log10p1 log1p log2 log2p1 pow pown powf rsqrt sin sinh sinpi tan tanh tanpi)
 FUNCTIONS_SPECIAL=(atan2pif hypotf)
+# the functions with a batch variant cr_f_n (see check.sh --batch)
+FUNCTIONS_BATCH=(cosf cospif expf exp10f exp2f expm1f logf log10f log1pf log2f sinf sinpif tanf)
 
 echo "Reference commit is $LAST_COMMIT"
 
+# With CORE_MATH_CI_DIFF_FAILURES set to the checkpoint directory of the
+# checks of the reference commit (CORE_MATH_CHECKPOINT_DIR, see check.sh),
+# the modified functions are checked against their version in that commit:
+# MPFR is only called on the inputs where both versions differ, or where that
+# version failed.  Otherwise, and for the checks not recorded there, all the
+# inputs are compared with MPFR.
+if [ -n "$CORE_MATH_CI_DIFF_FAILURES" ]; then
+    export CORE_MATH_DIFF_REV="$LAST_COMMIT"
+    export CORE_MATH_DIFF_FAILURES="$CORE_MATH_CI_DIFF_FAILURES"
+fi
+
 check () {
     KIND="$1"
-    if ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- src/*/*/$FUNCTION.c; then
+    # the source of the function, and the directories of the sources it
+    # includes (SOURCE_DIRS in its Makefile, see check.sh)
+    local d SOURCES=(src/*/*/$FUNCTION.c)
+    for d in $(sed -n 's/^SOURCE_DIRS := //p' "$(dirname "${SOURCES[0]}")/Makefile" 2> /dev/null); do
+        SOURCES+=("$(dirname "${SOURCES[0]}")/$d")
+    done
+    if ! { echo "$FORCE_FUNCTIONS" | tr ' ' '\n' | grep --quiet '^'"$FUNCTION"'$'; } && git diff --quiet "$LAST_COMMIT".. -- "${SOURCES[@]}"; then
         echo "Skipped $FUNCTION"
     else
         echo "Checking $FUNCTION..."
@@ -37,3 +56,7 @@ done
 for FUNCTION in "${FUNCTIONS_SPECIAL[@]}"; do
     check --special
 done
+
+for FUNCTION in "${FUNCTIONS_BATCH[@]}"; do
+    check --batch
+done
@@ -0,0 +1,15 @@
+#pragma once
+
+double __cdecl cr_acos(double x);
+
+// cr_acos for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_acos_rn(double x);
+double __cdecl cr_acos_rd(double x);
+double __cdecl cr_acos_ru(double x);
+double __cdecl cr_acos_rz(double x);
+
+// cr_acos_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_acos_rn_nse(double x);
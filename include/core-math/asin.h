@@ -0,0 +1,15 @@
+#pragma once
+
+double __cdecl cr_asin(double x);
+
+// cr_asin for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_asin_rn(double x);
+double __cdecl cr_asin_rd(double x);
+double __cdecl cr_asin_ru(double x);
+double __cdecl cr_asin_rz(double x);
+
+// cr_asin_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_asin_rn_nse(double x);
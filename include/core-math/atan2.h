@@ -0,0 +1,15 @@
+#pragma once
+
+double __cdecl cr_atan2(double y, double x);
+
+// cr_atan2 for a rounding mode known in advance, which must be the current
+// one: to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_atan2_rn(double y, double x);
+double __cdecl cr_atan2_rd(double y, double x);
+double __cdecl cr_atan2_ru(double y, double x);
+double __cdecl cr_atan2_rz(double y, double x);
+
+// cr_atan2_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_atan2_rn_nse(double y, double x);
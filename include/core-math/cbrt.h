@@ -0,0 +1,15 @@
+#pragma once
+
+double __cdecl cr_cbrt(double x);
+
+// cr_cbrt for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_cbrt_rn(double x);
+double __cdecl cr_cbrt_rd(double x);
+double __cdecl cr_cbrt_ru(double x);
+double __cdecl cr_cbrt_rz(double x);
+
+// cr_cbrt_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_cbrt_rn_nse(double x);
@@ -1,3 +1,24 @@
 #pragma once
 
+#include <stddef.h>
+
 double __cdecl cr_cos(double x);
+
+// cr_cos for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_cos_rn(double x);
+double __cdecl cr_cos_rd(double x);
+double __cdecl cr_cos_ru(double x);
+double __cdecl cr_cos_rz(double x);
+
+// cr_cos_rn without side effects: it returns the same values (thus must also be
+// called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_cos_rn_nse(double x);
+
+// Accurate path of cr_cos, taken when the rounding test of the fast path
+// fails.  Requires x finite with x > 0x1.6a09e667f3bccp-27.
+double __cdecl cr_cos_accurate(double x);
+
+// Sets y[k] = cr_cos(x[k]) for 0 <= k < n.  x and y may be equal.
+void __cdecl cr_cos_n(const double *x, double *y, size_t n);
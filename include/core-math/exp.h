@@ -0,0 +1,19 @@
+#pragma once
+
+double __cdecl cr_exp(double x);
+
+// cr_exp for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_exp_rn(double x);
+double __cdecl cr_exp_rd(double x);
+double __cdecl cr_exp_ru(double x);
+double __cdecl cr_exp_rz(double x);
+
+// cr_exp_rn without side effects: it returns the same values (thus must also be
+// called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_exp_rn_nse(double x);
+
+// Accurate path of cr_exp, taken when the rounding test of the fast path
+// fails.  Requires -0x1.74910d52d3052p+9 < x < 0x1.62e42fefa39fp+9.
+double __cdecl cr_exp_accurate(double x);
@@ -0,0 +1,15 @@
+#pragma once
+
+double __cdecl cr_hypot(double x, double y);
+
+// cr_hypot for a rounding mode known in advance, which must be the current
+// one: to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_hypot_rn(double x, double y);
+double __cdecl cr_hypot_rd(double x, double y);
+double __cdecl cr_hypot_ru(double x, double y);
+double __cdecl cr_hypot_rz(double x, double y);
+
+// cr_hypot_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_hypot_rn_nse(double x, double y);
@@ -0,0 +1,19 @@
+#pragma once
+
+double __cdecl cr_log(double x);
+
+// cr_log for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_log_rn(double x);
+double __cdecl cr_log_rd(double x);
+double __cdecl cr_log_ru(double x);
+double __cdecl cr_log_rz(double x);
+
+// cr_log_rn without side effects: it returns the same values (thus must also be
+// called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_log_rn_nse(double x);
+
+// Accurate path of cr_log, taken when the rounding test of the fast path
+// fails.  Requires x finite with x > 0.
+double __cdecl cr_log_accurate(double x);
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+double __cdecl cr_pow(double x, double y);
+
+// cr_pow for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_pow_rn(double x, double y);
+double __cdecl cr_pow_rd(double x, double y);
+double __cdecl cr_pow_ru(double x, double y);
+double __cdecl cr_pow_rz(double x, double y);
+
+// cr_pow_rn without side effects: it returns the same values (thus must also be
+// called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_pow_rn_nse(double x, double y);
+
+// Sets r[k] = cr_pow(x[k], y) for 0 <= k < n.  x and r may be equal.
+void __cdecl cr_pow_n(const double *x, double y, double *r, size_t n);
+
+// Correctly rounded x^n for an integer n, including when |n| > 2^53.
+double __cdecl cr_pown(double x, int64_t n);
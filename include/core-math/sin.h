@@ -1,3 +1,24 @@
 #pragma once
 
+#include <stddef.h>
+
 double __cdecl cr_sin(double x);
+
+// cr_sin for a rounding mode known in advance, which must be the current one:
+// to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+double __cdecl cr_sin_rn(double x);
+double __cdecl cr_sin_rd(double x);
+double __cdecl cr_sin_ru(double x);
+double __cdecl cr_sin_rz(double x);
+
+// cr_sin_rn without side effects: it returns the same values (thus must also be
+// called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+double __cdecl cr_sin_rn_nse(double x);
+
+// Accurate path of cr_sin, taken when the rounding test of the fast path
+// fails.  Requires x finite with |x| > 0x1.7137449123ef6p-26.
+double __cdecl cr_sin_accurate(double x);
+
+// Sets y[k] = cr_sin(x[k]) for 0 <= k < n.  x and y may be equal.
+void __cdecl cr_sin_n(const double *x, double *y, size_t n);
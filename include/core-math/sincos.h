@@ -0,0 +1,15 @@
+#pragma once
+
+void __cdecl cr_sincos(double x, double *s, double *c);
+
+// cr_sincos for a rounding mode known in advance, which must be the current
+// one: to nearest (rn), downward (rd), upward (ru) or toward zero (rz).
+void __cdecl cr_sincos_rn(double x, double *s, double *c);
+void __cdecl cr_sincos_rd(double x, double *s, double *c);
+void __cdecl cr_sincos_ru(double x, double *s, double *c);
+void __cdecl cr_sincos_rz(double x, double *s, double *c);
+
+// cr_sincos_rn without side effects: it returns the same values (thus must also
+// be called when rounding to nearest), but may not set errno nor raise the
+// exception flags.
+void __cdecl cr_sincos_rn_nse(double x, double *s, double *c);
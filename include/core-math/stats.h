@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Statistics on the paths taken by the functions of the library.  When the
+   library is built with CORE_MATH_STATS defined (make CORE_MATH_STATS=1),
+   each function counts, for the calling thread, how its results were
+   obtained; otherwise all the counters stay zero.  cr_sincos counts its two
+   results separately, and the batch functions count each element under the
+   corresponding scalar function. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum cr_stats_function {
+  CR_STATS_ACOS,
+  CR_STATS_ASIN,
+  CR_STATS_ATAN2,
+  CR_STATS_CBRT,
+  CR_STATS_COS,
+  CR_STATS_EXP,
+  CR_STATS_HYPOT,
+  CR_STATS_LOG,
+  CR_STATS_POW,
+  CR_STATS_POWN,
+  CR_STATS_SIN,
+  CR_STATS_SINCOS,
+  CR_STATS_TAN,
+  CR_STATS_FUNCTIONS
+};
+
+typedef struct {
+  uint64_t fast;      // results returned by the fast path
+  uint64_t accurate;  // fallbacks to the accurate path
+  uint64_t database;  // accurate results found in a table of hard cases
+  uint64_t special;   // special values and other early exits
+} cr_stats_t;
+
+// Sets *s to the counters of f for the calling thread.
+void __cdecl cr_stats_get(enum cr_stats_function f, cr_stats_t *s);
+
+// Resets the counters of all the functions for the calling thread.
+void __cdecl cr_stats_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* The following is used by the library (and by core-math/inline.h) to
+   update the counters.  The number of special exits is not counted, it is
+   derived from the number of calls.  The declarations above have C linkage,
+   so that C programs (like the perf harness with --worst) can use them. */
+
+#ifdef __cplusplus
+typedef struct {
+  uint64_t calls;
+  uint64_t fast;
+  uint64_t accurate;
+  uint64_t database;
+} cr_stats_counters_t;
+
+extern thread_local constinit cr_stats_counters_t
+  cr_stats_counters[CR_STATS_FUNCTIONS];
+
+#if defined(CORE_MATH_STATS)
+#define CORE_MATH_STATS_ADD(f, counter, n) \
+  (cr_stats_counters[CR_STATS_##f].counter += (n))
+#else
+#define CORE_MATH_STATS_ADD(f, counter, n) ((void) 0)
+#endif
+#define CORE_MATH_STATS_COUNT(f, counter) CORE_MATH_STATS_ADD (f, counter, 1)
+#endif // __cplusplus
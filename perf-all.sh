@@ -3,6 +3,8 @@
 # ./perf-all.sh
 # CORE_MATH_QUIET=1 ./perf-all.sh
 # CORE_MATH_SIMPLE_STAT=1 ./perf-all.sh (old stat mechanism)
+# CORE_MATH_PERF_MODE=counters ./perf-all.sh (JSON, one line per libm)
+# CORE_MATH_PERF_ROUNDING=rn_nse ./perf-all.sh (see README.md)
 
 # this is to make the order of functions deterministic
 export LC_ALL=C
@@ -15,6 +17,11 @@ fi
 
 for u in src/binary*/*/Makefile; do
     f="$(sed -n 's/FUNCTION_UNDER_TEST := //p' $u)"
-    echo -n "$f "
-    ./perf.sh $f | xargs echo
+    if [ "$CORE_MATH_PERF_MODE" = counters ]; then
+        # the JSON objects already contain the function name
+        ./perf.sh $f
+    else
+        echo -n "$f "
+        ./perf.sh $f | xargs echo
+    fi
 done
@@ -120,11 +120,19 @@ u="$(echo src/binary*/*/$f.c)"
 
 if [ -z "$CORE_MATH_PERF_MODE" ]; then
     if [ -z "$CORE_MATH_QUIET" ]; then
-        echo 'CORE_MATH_PERF_MODE (perf or rdtsc) environment variable is not set. The default is perf.'
+        echo 'CORE_MATH_PERF_MODE (perf, rdtsc, counters, cold, histogram or worst) environment variable is not set. The default is perf.'
     fi
     CORE_MATH_PERF_MODE=perf
 fi
 
+# CORE_MATH_PERF_DISTRIBUTION selects the input distribution, see
+# src/generic/support/perf_distribution.h; a relative trace file is taken
+# from the current directory
+case "$CORE_MATH_PERF_DISTRIBUTION" in
+    trace:/*) ;;
+    trace:*) CORE_MATH_PERF_DISTRIBUTION="trace:$PWD/${CORE_MATH_PERF_DISTRIBUTION#trace:}" ;;
+esac
+
 if [ -f "$u" ]; then
     dir="${u%/*}"
 else
@@ -143,6 +151,19 @@ if [ "$CFLAGS" == "" ]; then
       ROUNDING_MATH=
    fi
 fi
+# With CORE_MATH_PERF_ROUNDING=rn, the function under test is compiled for
+# rounding to nearest only, as the cr_f_rn variants of the library are, and
+# with CORE_MATH_PERF_ROUNDING=rn_nse also without side effects (errno and
+# exception flags), as the cr_f_rn_nse variants are.
+case "$CORE_MATH_PERF_ROUNDING" in
+   rn|rn_nse)
+      CFLAGS="$CFLAGS -DCORE_MATH_ROUNDING=FE_TONEAREST"
+      ROUNDING_MATH=
+      ;;
+esac
+if [ "$CORE_MATH_PERF_ROUNDING" = rn_nse ]; then
+   CFLAGS="$CFLAGS -DCORE_MATH_NO_SIDE_EFFECTS"
+fi
 export CFLAGS ROUNDING_MATH
 
 if [ -n "$LIBM" ]; then
@@ -164,12 +185,28 @@ if [ -z "$CORE_MATH_QUIET" ]; then
     done
 fi
 
+if [ "$CORE_MATH_PERF_MODE" = worst ]; then
+    # the inputs are the entries of the .wc file; the functions with counters
+    # in include/core-math/stats.h are built with them, so that the fast and
+    # accurate paths are reported separately
+    CORE_MATH_PERF_DISTRIBUTION=${CORE_MATH_PERF_DISTRIBUTION:-near-worst}
+    if grep -q "CR_STATS_${f^^}," include/core-math/stats.h; then
+        export CORE_MATH_STATS=1
+    fi
+fi
+
 cd $dir
 make -s clean
 make -s perf
 
 # prepare random arguments for performance test
-./perf --file ${RANDOMS_FILE} --count ${N} --reference
+./perf --file ${RANDOMS_FILE} --count ${N} --reference \
+       ${CORE_MATH_PERF_DISTRIBUTION:+--distribution "$CORE_MATH_PERF_DISTRIBUTION"}
+
+if [ "$CORE_MATH_PERF_MODE" = cold ] || [ "$CORE_MATH_PERF_MODE" = worst ]; then
+    # each call is timed individually, one pass is enough
+    M=${PERF_REPEAT:-1}
+fi
 
 PERF_ARGS="${PERF_ARGS} --file ${RANDOMS_FILE} --count ${N} --repeat ${M}"
 
@@ -185,6 +222,42 @@ elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
 
     PERF_ARGS="${PERF_ARGS} --libc"
     proc_rdtsc
+
+elif [ "$CORE_MATH_PERF_MODE" = cold ]; then
+    # CORE_MATH_PERF_EVICT is the working set swept between two calls
+    PERF_ARGS="${PERF_ARGS} --evict ${CORE_MATH_PERF_EVICT:-1M}"
+    proc_rdtsc
+
+    PERF_ARGS="${PERF_ARGS} --libc"
+    proc_rdtsc
+
+elif [ "$CORE_MATH_PERF_MODE" = counters ]; then
+    # the S trials run in a single process, which reads the hardware
+    # counters itself and prints one JSON object
+    PERF_ARGS="${PERF_ARGS} --trials ${S} --json"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+    PERF_ARGS="${PERF_ARGS} --libc"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+elif [ "$CORE_MATH_PERF_MODE" = histogram ]; then
+    # one run is enough, since each call is timed individually
+    PERF_ARGS="${PERF_ARGS} --histogram"
+    echo "core-math:"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+    PERF_ARGS="${PERF_ARGS} --libc"
+    echo "libc:"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+elif [ "$CORE_MATH_PERF_MODE" = worst ]; then
+    PERF_ARGS="${PERF_ARGS} --worst"
+    echo "core-math:"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+    PERF_ARGS="${PERF_ARGS} --libc"
+    echo "libc:"
+    $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
 fi
 
 has_symbol () {
@@ -203,6 +276,16 @@ if [ -n "$BACKUP_LIBM" ]; then
         elif [ "$CORE_MATH_PERF_MODE" = rdtsc ]; then
             PERF_ARGS="${PERF_ARGS} --rdtsc"
             proc_rdtsc
+
+        elif [ "$CORE_MATH_PERF_MODE" = cold ]; then
+            proc_rdtsc
+
+        elif [ "$CORE_MATH_PERF_MODE" = counters ]; then
+            $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
+
+        elif [ "$CORE_MATH_PERF_MODE" = histogram ] || [ "$CORE_MATH_PERF_MODE" = worst ]; then
+            echo "$LIBM:"
+            $CORE_MATH_LAUNCHER ./perf $PERF_ARGS
         fi
     elif [ -z "$CORE_MATH_QUIET" ]; then
         echo "$f is not present in $LIBM; skipping" >&2
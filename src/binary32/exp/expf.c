@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -37,29 +42,31 @@ SOFTWARE.
 typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
+// shared by cr_expf() and cr_expf_n()
+static const double b[] =
+  {1, 0x1.62e42fef4c4e7p-1, 0x1.ebfd1b232f475p-3, 0x1.c6b19384ecd93p-5};
+static const uint64_t tb[] =
+  {0x3ff0000000000000, 0x3ff02c9a3e778061, 0x3ff059b0d3158574, 0x3ff0874518759bc8,
+   0x3ff0b5586cf9890f, 0x3ff0e3ec32d3d1a2, 0x3ff11301d0125b51, 0x3ff1429aaea92de0,
+   0x3ff172b83c7d517b, 0x3ff1a35beb6fcb75, 0x3ff1d4873168b9aa, 0x3ff2063b88628cd6,
+   0x3ff2387a6e756238, 0x3ff26b4565e27cdd, 0x3ff29e9df51fdee1, 0x3ff2d285a6e4030b,
+   0x3ff306fe0a31b715, 0x3ff33c08b26416ff, 0x3ff371a7373aa9cb, 0x3ff3a7db34e59ff7,
+   0x3ff3dea64c123422, 0x3ff4160a21f72e2a, 0x3ff44e086061892d, 0x3ff486a2b5c13cd0,
+   0x3ff4bfdad5362a27, 0x3ff4f9b2769d2ca7, 0x3ff5342b569d4f82, 0x3ff56f4736b527da,
+   0x3ff5ab07dd485429, 0x3ff5e76f15ad2148, 0x3ff6247eb03a5585, 0x3ff6623882552225,
+   0x3ff6a09e667f3bcd, 0x3ff6dfb23c651a2f, 0x3ff71f75e8ec5f74, 0x3ff75feb564267c9,
+   0x3ff7a11473eb0187, 0x3ff7e2f336cf4e62, 0x3ff82589994cce13, 0x3ff868d99b4492ed,
+   0x3ff8ace5422aa0db, 0x3ff8f1ae99157736, 0x3ff93737b0cdc5e5, 0x3ff97d829fde4e50,
+   0x3ff9c49182a3f090, 0x3ffa0c667b5de565, 0x3ffa5503b23e255d, 0x3ffa9e6b5579fdbf,
+   0x3ffae89f995ad3ad, 0x3ffb33a2b84f15fb, 0x3ffb7f76f2fb5e47, 0x3ffbcc1e904bc1d2,
+   0x3ffc199bdd85529c, 0x3ffc67f12e57d14b, 0x3ffcb720dcef9069, 0x3ffd072d4a07897c,
+   0x3ffd5818dcfba487, 0x3ffda9e603db3285, 0x3ffdfc97337b9b5f, 0x3ffe502ee78b3ff6,
+   0x3ffea4afa2a490da, 0x3ffefa1bee615a27, 0x3fff50765b6e4540, 0x3fffa7c1819e90d8};
+
 float cr_expf(float x){
   static const double c[] =
     {0x1.62e42fefa39efp-1, 0x1.ebfbdff82c58fp-3, 0x1.c6b08d702e0edp-5,
      0x1.3b2ab6fb92e5ep-7, 0x1.5d886e6d54203p-10, 0x1.430976b8ce6efp-13};
-  static const double b[] =
-    {1, 0x1.62e42fef4c4e7p-1, 0x1.ebfd1b232f475p-3, 0x1.c6b19384ecd93p-5};
-  static const uint64_t tb[] =
-    {0x3ff0000000000000, 0x3ff02c9a3e778061, 0x3ff059b0d3158574, 0x3ff0874518759bc8,
-     0x3ff0b5586cf9890f, 0x3ff0e3ec32d3d1a2, 0x3ff11301d0125b51, 0x3ff1429aaea92de0,
-     0x3ff172b83c7d517b, 0x3ff1a35beb6fcb75, 0x3ff1d4873168b9aa, 0x3ff2063b88628cd6,
-     0x3ff2387a6e756238, 0x3ff26b4565e27cdd, 0x3ff29e9df51fdee1, 0x3ff2d285a6e4030b,
-     0x3ff306fe0a31b715, 0x3ff33c08b26416ff, 0x3ff371a7373aa9cb, 0x3ff3a7db34e59ff7,
-     0x3ff3dea64c123422, 0x3ff4160a21f72e2a, 0x3ff44e086061892d, 0x3ff486a2b5c13cd0,
-     0x3ff4bfdad5362a27, 0x3ff4f9b2769d2ca7, 0x3ff5342b569d4f82, 0x3ff56f4736b527da,
-     0x3ff5ab07dd485429, 0x3ff5e76f15ad2148, 0x3ff6247eb03a5585, 0x3ff6623882552225,
-     0x3ff6a09e667f3bcd, 0x3ff6dfb23c651a2f, 0x3ff71f75e8ec5f74, 0x3ff75feb564267c9,
-     0x3ff7a11473eb0187, 0x3ff7e2f336cf4e62, 0x3ff82589994cce13, 0x3ff868d99b4492ed,
-     0x3ff8ace5422aa0db, 0x3ff8f1ae99157736, 0x3ff93737b0cdc5e5, 0x3ff97d829fde4e50,
-     0x3ff9c49182a3f090, 0x3ffa0c667b5de565, 0x3ffa5503b23e255d, 0x3ffa9e6b5579fdbf,
-     0x3ffae89f995ad3ad, 0x3ffb33a2b84f15fb, 0x3ffb7f76f2fb5e47, 0x3ffbcc1e904bc1d2,
-     0x3ffc199bdd85529c, 0x3ffc67f12e57d14b, 0x3ffcb720dcef9069, 0x3ffd072d4a07897c,
-     0x3ffd5818dcfba487, 0x3ffda9e603db3285, 0x3ffdfc97337b9b5f, 0x3ffe502ee78b3ff6,
-     0x3ffea4afa2a490da, 0x3ffefa1bee615a27, 0x3fff50765b6e4540, 0x3fffa7c1819e90d8};
   const double iln2 = 0x1.71547652b82fep+0, big = 0x1.8p46;
   b32u32_u t = {.f = x};
   double z = x, a = iln2*z;
@@ -97,3 +104,83 @@ float cr_expf(float x){
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_expf_n(). */
+#define EXPF_N_LANES 8
+
+/* Same as the fast path of cr_expf() on the 4 lanes of x, with the tb[]
+   lookups done by a gather.  The operations are those of cr_expf(), in the
+   same order, thus each lane of y is bit-identical to cr_expf(x) when the
+   rounding test succeeds.  Return the mask of the lanes which are not
+   special for cr_expf() (the range check on ux) and for which the rounding
+   test succeeds. */
+static inline unsigned
+expf_fast_avx2 (float *y, __m128 x)
+{
+  const double iln2 = 0x1.71547652b82fep+0, big = 0x1.8p46;
+  // 0x6f93813e <= ux <= 0x859d1d80 with ux = t.u<<1
+  __m128i ux = _mm_sub_epi32 (_mm_slli_epi32 (_mm_castps_si128 (x), 1),
+                              _mm_set1_epi32 (0x6f93813e));
+  __m128i lim = _mm_set1_epi32 (0x859d1d80 - 0x6f93813e);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (ux, lim), ux);
+  // 1 is a dummy argument for the special lanes
+  x = _mm_blendv_ps (_mm_set1_ps (1.0f), x, _mm_castsi128_ps (in));
+
+  __m256d z = _mm256_cvtps_pd (x);
+  __m256d a = _mm256_mul_pd (_mm256_set1_pd (iln2), z);
+  __m256d u = _mm256_add_pd (a, _mm256_set1_pd (big));
+  __m256d ia = _mm256_sub_pd (_mm256_set1_pd (big), u);
+  __m256d h = _mm256_add_pd (a, ia);
+  __m256i uu = _mm256_castpd_si256 (u);
+  __m256i sv = _mm256_i64gather_epi64 ((const long long *) tb,
+    _mm256_and_si256 (uu, _mm256_set1_epi64x (0x3f)), 8);
+  sv = _mm256_add_epi64 (sv, _mm256_slli_epi64 (_mm256_srli_epi64 (uu, 6), 52));
+  __m256d h2 = _mm256_mul_pd (h, h);
+  __m256d p = _mm256_add_pd (_mm256_set1_pd (b[0]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[1])));
+  __m256d q = _mm256_add_pd (_mm256_set1_pd (b[2]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[3])));
+  __m256d r = _mm256_mul_pd (_mm256_add_pd (p, _mm256_mul_pd (h2, q)),
+                             _mm256_castsi256_pd (sv));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_sub_pd (
+    r, _mm256_mul_pd (r, _mm256_set1_pd (1.45e-10))));
+  _mm_storeu_ps (y, ub);
+  __m128 ok = _mm_and_ps (_mm_cmpeq_ps (ub, lb), _mm_castsi128_ps (in));
+  return _mm_movemask_ps (ok);
+}
+
+/* Evaluate expf on the EXPF_N_LANES values of x, four at a time.  The
+   special arguments (tiny, large, infinite or NaN) and those for which the
+   rounding test fails go through cr_expf(). */
+static void
+expf_n_block (const float *x, float *y)
+{
+  float xs[EXPF_N_LANES], ys[EXPF_N_LANES];
+  for (int j = 0; j < EXPF_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < EXPF_N_LANES; j += 4)
+    ok |= expf_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << EXPF_N_LANES) - 1, 0))
+    for (int j = 0; j < EXPF_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_expf (xs[j]);
+  for (int j = 0; j < EXPF_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_expf(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_expf_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + EXPF_N_LANES <= n; k += EXPF_N_LANES)
+    expf_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_expf (x[k]);
+}
@@ -1,19 +1,20 @@
 #define cr_function_under_test cr_expf
+#define cr_function_under_test_n cr_expf_n
 #define ref_function_under_test ref_exp
 
 void doit (uint32_t n);
 static inline uint32_t asuint (float f);
 
+static void
+check_one (uint32_t n)
+{
+  doit (n);
+  doit (n | 0x80000000);
+}
+
 static inline int doloop (void)
 {
   /* exp is defined everywhere */
   uint32_t nmin = asuint (0x0p0f), nmax = asuint (0x1.fffffep127f);
-#pragma omp parallel for schedule(dynamic,1024)
-  for (uint32_t n = nmin; n <= nmax; n++)
-  {
-    doit (n);
-    doit (n | 0x80000000);
-  }
-  printf ("all ok\n");
-  return 0;
+  return check_range (nmin, nmax, check_one);
 }
@@ -24,10 +24,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -78,21 +83,23 @@ __builtin_roundeven (double x)
 }
 #endif
 
+// shared by cr_exp10f() and cr_exp10f_n()
+static const double b[] =
+  {1, 0x1.62e42fef4c4e7p-6, 0x1.ebfd1b232f475p-13, 0x1.c6b19384ecd93p-20};
+static const uint64_t tb[] =
+  {0x3ff0000000000000, 0x3ff059b0d3158574, 0x3ff0b5586cf9890f, 0x3ff11301d0125b51,
+   0x3ff172b83c7d517b, 0x3ff1d4873168b9aa, 0x3ff2387a6e756238, 0x3ff29e9df51fdee1,
+   0x3ff306fe0a31b715, 0x3ff371a7373aa9cb, 0x3ff3dea64c123422, 0x3ff44e086061892d,
+   0x3ff4bfdad5362a27, 0x3ff5342b569d4f82, 0x3ff5ab07dd485429, 0x3ff6247eb03a5585,
+   0x3ff6a09e667f3bcd, 0x3ff71f75e8ec5f74, 0x3ff7a11473eb0187, 0x3ff82589994cce13,
+   0x3ff8ace5422aa0db, 0x3ff93737b0cdc5e5, 0x3ff9c49182a3f090, 0x3ffa5503b23e255d,
+   0x3ffae89f995ad3ad, 0x3ffb7f76f2fb5e47, 0x3ffc199bdd85529c, 0x3ffcb720dcef9069,
+   0x3ffd5818dcfba487, 0x3ffdfc97337b9b5f, 0x3ffea4afa2a490da, 0x3fff50765b6e4540};
+
 float cr_exp10f(float x){
   static const double c[] =
     {0x1.62e42fefa39efp-1, 0x1.ebfbdff82c58fp-3, 0x1.c6b08d702e0edp-5,
      0x1.3b2ab6fb92e5ep-7, 0x1.5d886e6d54203p-10, 0x1.430976b8ce6efp-13};
-  static const double b[] =
-    {1, 0x1.62e42fef4c4e7p-6, 0x1.ebfd1b232f475p-13, 0x1.c6b19384ecd93p-20};
-  static const uint64_t tb[] =
-    {0x3ff0000000000000, 0x3ff059b0d3158574, 0x3ff0b5586cf9890f, 0x3ff11301d0125b51,
-     0x3ff172b83c7d517b, 0x3ff1d4873168b9aa, 0x3ff2387a6e756238, 0x3ff29e9df51fdee1,
-     0x3ff306fe0a31b715, 0x3ff371a7373aa9cb, 0x3ff3dea64c123422, 0x3ff44e086061892d,
-     0x3ff4bfdad5362a27, 0x3ff5342b569d4f82, 0x3ff5ab07dd485429, 0x3ff6247eb03a5585,
-     0x3ff6a09e667f3bcd, 0x3ff71f75e8ec5f74, 0x3ff7a11473eb0187, 0x3ff82589994cce13,
-     0x3ff8ace5422aa0db, 0x3ff93737b0cdc5e5, 0x3ff9c49182a3f090, 0x3ffa5503b23e255d,
-     0x3ffae89f995ad3ad, 0x3ffb7f76f2fb5e47, 0x3ffc199bdd85529c, 0x3ffcb720dcef9069,
-     0x3ffd5818dcfba487, 0x3ffdfc97337b9b5f, 0x3ffea4afa2a490da, 0x3fff50765b6e4540};
   static const float ex[] =
     {10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000, 10000000000};
   const double iln102 = 0x1.a934f0979a371p+6, iln102h = 0x1.a934f09p+1, iln102l = 0x1.e68dc57f2496p-29;
@@ -139,3 +146,87 @@ float cr_exp10f(float x){
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_exp10f_n(). */
+#define EXP10F_N_LANES 8
+
+/* Same as the fast path of cr_exp10f() on the 4 lanes of x, with the tb[]
+   lookups done by a gather.  The operations are those of cr_exp10f(), in the
+   same order, thus each lane of y is bit-identical to cr_exp10f(x) when the
+   rounding test succeeds.  Return the mask of the lanes which are not
+   special for cr_exp10f() (the range check on ux, and the check for exact
+   powers of 10) and for which the rounding test succeeds. */
+static inline unsigned
+exp10f_fast_avx2 (float *y, __m128 x)
+{
+  const double iln102 = 0x1.a934f0979a371p+6;
+  // 0x72adf1c6 <= ux <= 0x8466d3e8 with ux = t.u<<1, and t.u<<12 != 0
+  __m128i t = _mm_castps_si128 (x);
+  __m128i v = _mm_sub_epi32 (_mm_slli_epi32 (t, 1),
+                             _mm_set1_epi32 (0x72adf1c6));
+  __m128i lim = _mm_set1_epi32 (0x8466d3e8 - 0x72adf1c6);
+  __m128i in = _mm_andnot_si128 (
+    _mm_cmpeq_epi32 (_mm_slli_epi32 (t, 12), _mm_setzero_si128 ()),
+    _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v));
+  // 1 is a dummy argument for the special lanes
+  x = _mm_blendv_ps (_mm_set1_ps (1.0f), x, _mm_castsi128_ps (in));
+
+  __m256d z = _mm256_cvtps_pd (x);
+  __m256d a = _mm256_mul_pd (_mm256_set1_pd (iln102), z);
+  __m256d ia = _mm256_round_pd (a, _MM_FROUND_TO_NEAREST_INT
+                                   | _MM_FROUND_NO_EXC);
+  __m256d h = _mm256_sub_pd (a, ia);
+  __m128i ja = _mm256_cvtpd_epi32 (ia); // exact
+  __m256i sv = _mm256_i32gather_epi64 ((const long long *) tb,
+    _mm_and_si128 (ja, _mm_set1_epi32 (0x1f)), 8);
+  sv = _mm256_add_epi64 (sv, _mm256_slli_epi64 (
+    _mm256_cvtepi32_epi64 (_mm_srai_epi32 (ja, 5)), 52));
+  __m256d h2 = _mm256_mul_pd (h, h);
+  __m256d p = _mm256_add_pd (_mm256_set1_pd (b[0]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[1])));
+  __m256d q = _mm256_add_pd (_mm256_set1_pd (b[2]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[3])));
+  __m256d r = _mm256_mul_pd (_mm256_add_pd (p, _mm256_mul_pd (h2, q)),
+                             _mm256_castsi256_pd (sv));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_sub_pd (
+    r, _mm256_mul_pd (r, _mm256_set1_pd (1.45e-10))));
+  _mm_storeu_ps (y, ub);
+  __m128 ok = _mm_and_ps (_mm_cmpeq_ps (ub, lb), _mm_castsi128_ps (in));
+  return _mm_movemask_ps (ok);
+}
+
+/* Evaluate exp10f on the EXP10F_N_LANES values of x, four at a time.  The
+   special arguments (tiny, large, infinite, NaN or exact powers of 10) and
+   those for which the rounding test fails go through cr_exp10f(). */
+static void
+exp10f_n_block (const float *x, float *y)
+{
+  float xs[EXP10F_N_LANES], ys[EXP10F_N_LANES];
+  for (int j = 0; j < EXP10F_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < EXP10F_N_LANES; j += 4)
+    ok |= exp10f_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << EXP10F_N_LANES) - 1, 0))
+    for (int j = 0; j < EXP10F_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_exp10f (xs[j]);
+  for (int j = 0; j < EXP10F_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_exp10f(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_exp10f_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + EXP10F_N_LANES <= n; k += EXP10F_N_LANES)
+    exp10f_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_exp10f (x[k]);
+}
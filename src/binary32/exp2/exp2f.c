@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -57,25 +62,30 @@ static float as_special(float x){
   return r;
 }
 
-float cr_exp2f(float x){
-  static const b64u64_u tb[] =
-    {{0x1.0000000000000p+0}, {0x1.02c9a3e778061p+0}, {0x1.059b0d3158574p+0}, {0x1.0874518759bc8p+0},
-     {0x1.0b5586cf9890fp+0}, {0x1.0e3ec32d3d1a2p+0}, {0x1.11301d0125b51p+0}, {0x1.1429aaea92de0p+0},
-     {0x1.172b83c7d517bp+0}, {0x1.1a35beb6fcb75p+0}, {0x1.1d4873168b9aap+0}, {0x1.2063b88628cd6p+0},
-     {0x1.2387a6e756238p+0}, {0x1.26b4565e27cddp+0}, {0x1.29e9df51fdee1p+0}, {0x1.2d285a6e4030bp+0},
-     {0x1.306fe0a31b715p+0}, {0x1.33c08b26416ffp+0}, {0x1.371a7373aa9cbp+0}, {0x1.3a7db34e59ff7p+0},
-     {0x1.3dea64c123422p+0}, {0x1.4160a21f72e2ap+0}, {0x1.44e086061892dp+0}, {0x1.486a2b5c13cd0p+0},
-     {0x1.4bfdad5362a27p+0}, {0x1.4f9b2769d2ca7p+0}, {0x1.5342b569d4f82p+0}, {0x1.56f4736b527dap+0},
-     {0x1.5ab07dd485429p+0}, {0x1.5e76f15ad2148p+0}, {0x1.6247eb03a5585p+0}, {0x1.6623882552225p+0},
-     {0x1.6a09e667f3bcdp+0}, {0x1.6dfb23c651a2fp+0}, {0x1.71f75e8ec5f74p+0}, {0x1.75feb564267c9p+0},
-     {0x1.7a11473eb0187p+0}, {0x1.7e2f336cf4e62p+0}, {0x1.82589994cce13p+0}, {0x1.868d99b4492edp+0},
-     {0x1.8ace5422aa0dbp+0}, {0x1.8f1ae99157736p+0}, {0x1.93737b0cdc5e5p+0}, {0x1.97d829fde4e50p+0},
-     {0x1.9c49182a3f090p+0}, {0x1.a0c667b5de565p+0}, {0x1.a5503b23e255dp+0}, {0x1.a9e6b5579fdbfp+0},
-     {0x1.ae89f995ad3adp+0}, {0x1.b33a2b84f15fbp+0}, {0x1.b7f76f2fb5e47p+0}, {0x1.bcc1e904bc1d2p+0},
-     {0x1.c199bdd85529cp+0}, {0x1.c67f12e57d14bp+0}, {0x1.cb720dcef9069p+0}, {0x1.d072d4a07897cp+0},
-     {0x1.d5818dcfba487p+0}, {0x1.da9e603db3285p+0}, {0x1.dfc97337b9b5fp+0}, {0x1.e502ee78b3ff6p+0},
-     {0x1.ea4afa2a490dap+0}, {0x1.efa1bee615a27p+0}, {0x1.f50765b6e4540p+0}, {0x1.fa7c1819e90d8p+0}};
+// shared by cr_exp2f() and cr_exp2f_n()
+static const b64u64_u tb[] =
+  {{0x1.0000000000000p+0}, {0x1.02c9a3e778061p+0}, {0x1.059b0d3158574p+0}, {0x1.0874518759bc8p+0},
+   {0x1.0b5586cf9890fp+0}, {0x1.0e3ec32d3d1a2p+0}, {0x1.11301d0125b51p+0}, {0x1.1429aaea92de0p+0},
+   {0x1.172b83c7d517bp+0}, {0x1.1a35beb6fcb75p+0}, {0x1.1d4873168b9aap+0}, {0x1.2063b88628cd6p+0},
+   {0x1.2387a6e756238p+0}, {0x1.26b4565e27cddp+0}, {0x1.29e9df51fdee1p+0}, {0x1.2d285a6e4030bp+0},
+   {0x1.306fe0a31b715p+0}, {0x1.33c08b26416ffp+0}, {0x1.371a7373aa9cbp+0}, {0x1.3a7db34e59ff7p+0},
+   {0x1.3dea64c123422p+0}, {0x1.4160a21f72e2ap+0}, {0x1.44e086061892dp+0}, {0x1.486a2b5c13cd0p+0},
+   {0x1.4bfdad5362a27p+0}, {0x1.4f9b2769d2ca7p+0}, {0x1.5342b569d4f82p+0}, {0x1.56f4736b527dap+0},
+   {0x1.5ab07dd485429p+0}, {0x1.5e76f15ad2148p+0}, {0x1.6247eb03a5585p+0}, {0x1.6623882552225p+0},
+   {0x1.6a09e667f3bcdp+0}, {0x1.6dfb23c651a2fp+0}, {0x1.71f75e8ec5f74p+0}, {0x1.75feb564267c9p+0},
+   {0x1.7a11473eb0187p+0}, {0x1.7e2f336cf4e62p+0}, {0x1.82589994cce13p+0}, {0x1.868d99b4492edp+0},
+   {0x1.8ace5422aa0dbp+0}, {0x1.8f1ae99157736p+0}, {0x1.93737b0cdc5e5p+0}, {0x1.97d829fde4e50p+0},
+   {0x1.9c49182a3f090p+0}, {0x1.a0c667b5de565p+0}, {0x1.a5503b23e255dp+0}, {0x1.a9e6b5579fdbfp+0},
+   {0x1.ae89f995ad3adp+0}, {0x1.b33a2b84f15fbp+0}, {0x1.b7f76f2fb5e47p+0}, {0x1.bcc1e904bc1d2p+0},
+   {0x1.c199bdd85529cp+0}, {0x1.c67f12e57d14bp+0}, {0x1.cb720dcef9069p+0}, {0x1.d072d4a07897cp+0},
+   {0x1.d5818dcfba487p+0}, {0x1.da9e603db3285p+0}, {0x1.dfc97337b9b5fp+0}, {0x1.e502ee78b3ff6p+0},
+   {0x1.ea4afa2a490dap+0}, {0x1.efa1bee615a27p+0}, {0x1.f50765b6e4540p+0}, {0x1.fa7c1819e90d8p+0}};
+static const double b[] = {1, 0x1.62e42fef4c4e7p-1, 0x1.ebfd1b232f475p-3, 0x1.c6b19384ecd93p-5};
+static const double c[] =
+  {0x1.62e42fefa39efp-1, 0x1.ebfbdff82c58fp-3, 0x1.c6b08d702e0edp-5, 0x1.3b2ab6fb92e5ep-7,
+   0x1.5d886e6d54203p-10, 0x1.430976b8ce6efp-13};
 
+float cr_exp2f(float x){
   b32u32_u t = {.f = x}, u = {.f = x + 0x1.8p17f};
   uint32_t ux = t.u<<1;
   double offd = 0x1.8p46, xd = x, h = xd - ((xd + offd) - offd), h2 = h*h;
@@ -85,7 +95,6 @@ float cr_exp2f(float x){
   }
   b64u64_u sv = tb[u.u&0x3f];
   sv.u += (long)(u.u>>6)<<52;
-  static const double b[] = {1, 0x1.62e42fef4c4e7p-1, 0x1.ebfd1b232f475p-3, 0x1.c6b19384ecd93p-5};
   double r = sv.f*((b[0] + h*b[1]) + h2*(b[2] + h*b[3])), eps = 0x1.3d8p-33;
   float ub = r, lb = r - r*eps;
   if(__builtin_expect(ub != lb, 1)){
@@ -94,11 +103,105 @@ float cr_exp2f(float x){
       if(t.u == 0xbcf3a937u) return 0x1.f58d62p-1f - 0x1p-26f;
       if(t.u == 0xb8d3d026u) return 0x1.fff6d2p-1f + 0x1p-26f;
     }
-    static const double c[] =
-      {0x1.62e42fefa39efp-1, 0x1.ebfbdff82c58fp-3, 0x1.c6b08d702e0edp-5, 0x1.3b2ab6fb92e5ep-7,
-       0x1.5d886e6d54203p-10, 0x1.430976b8ce6efp-13};
     r = sv.f + (sv.f*h)*((c[0] + h*c[1]) + h2*((c[2] + h*c[3]) + h2*(c[4] + h*c[5])));
     ub = r;
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_exp2f_n(). */
+#define EXP2F_N_LANES 8
+
+/* Same as cr_exp2f() on the 4 lanes of x, for the arguments outside the
+   range check on ux, with the tb[] lookups done by a gather.  Since the
+   rounding test of the first polynomial often fails, the second one is
+   evaluated on all lanes too, and selected where the test fails.  The
+   operations are those of cr_exp2f(), in the same order, thus each lane of
+   y is bit-identical to cr_exp2f(x).  Return the mask of the lanes which are
+   not special, and are not among the small arguments for which cr_exp2f()
+   checks for exceptions after a failed rounding test. */
+static inline unsigned
+exp2f_avx2 (float *y, __m128 x)
+{
+  // 0x65000000 <= ux < 0x86000000 with ux = t.u<<1
+  __m128i ux = _mm_slli_epi32 (_mm_castps_si128 (x), 1);
+  __m128i v = _mm_sub_epi32 (ux, _mm_set1_epi32 (0x65000000));
+  __m128i lim = _mm_set1_epi32 (0x86000000 - 0x65000000 - 1);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // ux <= 0x79e7526e
+  lim = _mm_set1_epi32 (0x79e7526e);
+  __m128i small = _mm_cmpeq_epi32 (_mm_min_epu32 (ux, lim), ux);
+  // 1 is a dummy argument for the special lanes
+  x = _mm_blendv_ps (_mm_set1_ps (1.0f), x, _mm_castsi128_ps (in));
+
+  __m128i u = _mm_castps_si128 (_mm_add_ps (x, _mm_set1_ps (0x1.8p17f)));
+  __m256d offd = _mm256_set1_pd (0x1.8p46), xd = _mm256_cvtps_pd (x);
+  __m256d h = _mm256_sub_pd (xd, _mm256_sub_pd (_mm256_add_pd (xd, offd),
+                                                offd));
+  __m256d h2 = _mm256_mul_pd (h, h);
+  __m256i sv = _mm256_i32gather_epi64 ((const long long *) tb,
+    _mm_and_si128 (u, _mm_set1_epi32 (0x3f)), 8);
+  sv = _mm256_add_epi64 (sv, _mm256_slli_epi64 (
+    _mm256_cvtepu32_epi64 (_mm_srli_epi32 (u, 6)), 52));
+  __m256d s = _mm256_castsi256_pd (sv);
+  __m256d p = _mm256_add_pd (_mm256_set1_pd (b[0]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[1])));
+  __m256d q = _mm256_add_pd (_mm256_set1_pd (b[2]),
+                             _mm256_mul_pd (h, _mm256_set1_pd (b[3])));
+  __m256d r = _mm256_mul_pd (s, _mm256_add_pd (p, _mm256_mul_pd (h2, q)));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_sub_pd (
+    r, _mm256_mul_pd (r, _mm256_set1_pd (0x1.3d8p-33))));
+  __m128 fail = _mm_cmpneq_ps (ub, lb);
+
+  // second polynomial
+  __m256d c0 = _mm256_add_pd (_mm256_set1_pd (c[0]),
+                              _mm256_mul_pd (h, _mm256_set1_pd (c[1])));
+  __m256d c2 = _mm256_add_pd (_mm256_set1_pd (c[2]),
+                              _mm256_mul_pd (h, _mm256_set1_pd (c[3])));
+  __m256d c4 = _mm256_add_pd (_mm256_set1_pd (c[4]),
+                              _mm256_mul_pd (h, _mm256_set1_pd (c[5])));
+  c2 = _mm256_add_pd (c2, _mm256_mul_pd (h2, c4));
+  c0 = _mm256_add_pd (c0, _mm256_mul_pd (h2, c2));
+  r = _mm256_add_pd (s, _mm256_mul_pd (_mm256_mul_pd (s, h), c0));
+  ub = _mm_blendv_ps (ub, _mm256_cvtpd_ps (r), fail);
+  _mm_storeu_ps (y, ub);
+  __m128i ok = _mm_andnot_si128 (
+    _mm_and_si128 (_mm_castps_si128 (fail), small), in);
+  return _mm_movemask_ps (_mm_castsi128_ps (ok));
+}
+
+/* Evaluate exp2f on the EXP2F_N_LANES values of x, four at a time.  The
+   special arguments (tiny, large, infinite or NaN) and the possible
+   exceptions of cr_exp2f() go through cr_exp2f(). */
+static void
+exp2f_n_block (const float *x, float *y)
+{
+  float xs[EXP2F_N_LANES], ys[EXP2F_N_LANES];
+  for (int j = 0; j < EXP2F_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < EXP2F_N_LANES; j += 4)
+    ok |= exp2f_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << EXP2F_N_LANES) - 1, 0))
+    for (int j = 0; j < EXP2F_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_exp2f (xs[j]);
+  for (int j = 0; j < EXP2F_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_exp2f(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_exp2f_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + EXP2F_N_LANES <= n; k += EXP2F_N_LANES)
+    exp2f_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_exp2f (x[k]);
+}
@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -77,21 +82,26 @@ __builtin_roundeven (double x)
 typedef union {float f; uint32_t u;} b32u32_u;
 typedef union {double f; uint64_t u;} b64u64_u;
 
+// shared by cr_expm1f() and cr_expm1f_n()
+static const double c[] =
+  {1, 0x1.62e42fef4c4e7p-6, 0x1.ebfd1b232f475p-13, 0x1.c6b19384ecd93p-20};
+static const double td[] =
+  {0x1p+0, 0x1.059b0d3158574p+0, 0x1.0b5586cf9890fp+0, 0x1.11301d0125b51p+0,
+   0x1.172b83c7d517bp+0, 0x1.1d4873168b9aap+0, 0x1.2387a6e756238p+0, 0x1.29e9df51fdee1p+0,
+   0x1.306fe0a31b715p+0, 0x1.371a7373aa9cbp+0, 0x1.3dea64c123422p+0, 0x1.44e086061892dp+0,
+   0x1.4bfdad5362a27p+0, 0x1.5342b569d4f82p+0, 0x1.5ab07dd485429p+0, 0x1.6247eb03a5585p+0,
+   0x1.6a09e667f3bcdp+0, 0x1.71f75e8ec5f74p+0, 0x1.7a11473eb0187p+0, 0x1.82589994cce13p+0,
+   0x1.8ace5422aa0dbp+0, 0x1.93737b0cdc5e5p+0, 0x1.9c49182a3f09p+0, 0x1.a5503b23e255dp+0,
+   0x1.ae89f995ad3adp+0, 0x1.b7f76f2fb5e47p+0, 0x1.c199bdd85529cp+0, 0x1.cb720dcef9069p+0,
+   0x1.d5818dcfba487p+0, 0x1.dfc97337b9b5fp+0, 0x1.ea4afa2a490dap+0, 0x1.f50765b6e454p+0};
+static const double b[] =
+  {0x1.fffffffffffc2p-2, 0x1.55555555555fep-3, 0x1.555555559767fp-5, 0x1.1111111098dc1p-7,
+   0x1.6c16bca988aa9p-10, 0x1.a01a07658483fp-13, 0x1.a05b04d2c3503p-16, 0x1.71de3a960b5e3p-19};
+
 float cr_expm1f(float x){
-  static const double c[] =
-    {1, 0x1.62e42fef4c4e7p-6, 0x1.ebfd1b232f475p-13, 0x1.c6b19384ecd93p-20};
   static const double ch[] =
     {0x1.62e42fefa39efp-6, 0x1.ebfbdff82c58fp-13, 0x1.c6b08d702e0edp-20, 0x1.3b2ab6fb92e5ep-27,
      0x1.5d886e6d54203p-35, 0x1.430976b8ce6efp-43};
-  static const double td[] =
-    {0x1p+0, 0x1.059b0d3158574p+0, 0x1.0b5586cf9890fp+0, 0x1.11301d0125b51p+0,
-     0x1.172b83c7d517bp+0, 0x1.1d4873168b9aap+0, 0x1.2387a6e756238p+0, 0x1.29e9df51fdee1p+0,
-     0x1.306fe0a31b715p+0, 0x1.371a7373aa9cbp+0, 0x1.3dea64c123422p+0, 0x1.44e086061892dp+0,
-     0x1.4bfdad5362a27p+0, 0x1.5342b569d4f82p+0, 0x1.5ab07dd485429p+0, 0x1.6247eb03a5585p+0,
-     0x1.6a09e667f3bcdp+0, 0x1.71f75e8ec5f74p+0, 0x1.7a11473eb0187p+0, 0x1.82589994cce13p+0,
-     0x1.8ace5422aa0dbp+0, 0x1.93737b0cdc5e5p+0, 0x1.9c49182a3f09p+0, 0x1.a5503b23e255dp+0,
-     0x1.ae89f995ad3adp+0, 0x1.b7f76f2fb5e47p+0, 0x1.c199bdd85529cp+0, 0x1.cb720dcef9069p+0,
-     0x1.d5818dcfba487p+0, 0x1.dfc97337b9b5fp+0, 0x1.ea4afa2a490dap+0, 0x1.f50765b6e454p+0};
   const double iln2 = 0x1.71547652b82fep+5, big = 0x1.8p52;
   b32u32_u t = {.f = x};
   double z = x;
@@ -101,9 +111,6 @@ float cr_expm1f(float x){
       if(__builtin_expect(ax==0x0u, 0)) return x; // x = +-0
       return __builtin_fmaf(__builtin_fabsf(x),0x1p-25f,x);
     }
-    static const double b[] =
-      {0x1.fffffffffffc2p-2, 0x1.55555555555fep-3, 0x1.555555559767fp-5, 0x1.1111111098dc1p-7,
-       0x1.6c16bca988aa9p-10, 0x1.a01a07658483fp-13, 0x1.a05b04d2c3503p-16, 0x1.71de3a960b5e3p-19};
     double z2 = z*z, z4 = z2*z2;
     double r = z + z2*((b[0]+z*b[1]) + z2*(b[2]+z*b[3]) + z4*((b[4]+z*b[5]) + z2*(b[6]+z*b[7])));
     return r;
@@ -136,3 +143,101 @@ float cr_expm1f(float x){
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_expm1f_n(). */
+#define EXPM1F_N_LANES 8
+
+/* Same as cr_expm1f() on the 4 lanes of x, for 0x1.6a09e8p-24 <= |x| <=
+   0x1.62e43p+6, with the td[] lookups done by a gather.  The polynomial for
+   |x| < 0.15625 and the fast path of the table-based evaluation are computed
+   on all lanes, and selected according to |x|.  The operations are those of
+   cr_expm1f(), in the same order, thus each lane of y is bit-identical to
+   cr_expm1f(x) when the rounding test succeeds.  Return the mask of the
+   lanes in the above range for which the rounding test succeeds (it is not
+   needed for |x| < 0.15625). */
+static inline unsigned
+expm1f_fast_avx2 (float *y, __m128 x)
+{
+  const double iln2 = 0x1.71547652b82fep+5, big = 0x1.8p52;
+  // 0x676a09e8 <= ax <= 0x8562e430 with ax = t.u<<1
+  __m128i ax = _mm_slli_epi32 (_mm_castps_si128 (x), 1);
+  __m128i v = _mm_sub_epi32 (ax, _mm_set1_epi32 (0x676a09e8));
+  __m128i lim = _mm_set1_epi32 (0x8562e430 - 0x676a09e8);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // ax < 0x7c400000, i.e., |x| < 0.15625
+  lim = _mm_set1_epi32 (0x7c400000 - 1);
+  __m128i small = _mm_cmpeq_epi32 (_mm_min_epu32 (ax, lim), ax);
+  // 1 is a dummy argument for the other lanes
+  x = _mm_blendv_ps (_mm_set1_ps (1.0f), x, _mm_castsi128_ps (in));
+  __m256d z = _mm256_cvtps_pd (x);
+
+  // |x| < 0.15625
+  __m256d z2 = _mm256_mul_pd (z, z), z4 = _mm256_mul_pd (z2, z2), p[4];
+  for (int i = 0; i < 4; i++)
+    p[i] = _mm256_add_pd (_mm256_set1_pd (b[2 * i]),
+                          _mm256_mul_pd (z, _mm256_set1_pd (b[2 * i + 1])));
+  __m256d q = _mm256_add_pd (p[0], _mm256_mul_pd (z2, p[1]));
+  q = _mm256_add_pd (q, _mm256_mul_pd (z4, _mm256_add_pd (
+    p[2], _mm256_mul_pd (z2, p[3]))));
+  __m128 ys = _mm256_cvtpd_ps (_mm256_add_pd (z, _mm256_mul_pd (z2, q)));
+
+  // 0.15625 <= |x|
+  __m256d a = _mm256_mul_pd (_mm256_set1_pd (iln2), z);
+  __m256d ia = _mm256_round_pd (a, _MM_FROUND_TO_NEAREST_INT
+                                   | _MM_FROUND_NO_EXC);
+  __m256d h = _mm256_sub_pd (a, ia), h2 = _mm256_mul_pd (h, h);
+  __m256i u = _mm256_castpd_si256 (_mm256_add_pd (ia, _mm256_set1_pd (big)));
+  __m256d c2 = _mm256_add_pd (_mm256_set1_pd (c[2]),
+                              _mm256_mul_pd (h, _mm256_set1_pd (c[3])));
+  __m256d c0 = _mm256_add_pd (_mm256_set1_pd (c[0]),
+                              _mm256_mul_pd (h, _mm256_set1_pd (c[1])));
+  __m256i sv = _mm256_i64gather_epi64 ((const long long *) td,
+    _mm256_and_si256 (u, _mm256_set1_epi64x (0x1f)), 8);
+  sv = _mm256_add_epi64 (sv, _mm256_slli_epi64 (_mm256_srli_epi64 (u, 5), 52));
+  __m256d s = _mm256_castsi256_pd (sv);
+  __m256d r = _mm256_sub_pd (_mm256_mul_pd (
+    _mm256_add_pd (c0, _mm256_mul_pd (h2, c2)), s), _mm256_set1_pd (1.0));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_sub_pd (
+    r, _mm256_mul_pd (s, _mm256_set1_pd (0x1.3b3p-33))));
+
+  __m128 ok = _mm_or_ps (_mm_cmpeq_ps (ub, lb), _mm_castsi128_ps (small));
+  _mm_storeu_ps (y, _mm_blendv_ps (ub, ys, _mm_castsi128_ps (small)));
+  ok = _mm_and_ps (ok, _mm_castsi128_ps (in));
+  return _mm_movemask_ps (ok);
+}
+
+/* Evaluate expm1f on the EXPM1F_N_LANES values of x, four at a time.  The
+   special arguments (tiny, large, infinite or NaN) and those for which the
+   rounding test fails go through cr_expm1f(). */
+static void
+expm1f_n_block (const float *x, float *y)
+{
+  float xs[EXPM1F_N_LANES], ys[EXPM1F_N_LANES];
+  for (int j = 0; j < EXPM1F_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < EXPM1F_N_LANES; j += 4)
+    ok |= expm1f_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << EXPM1F_N_LANES) - 1, 0))
+    for (int j = 0; j < EXPM1F_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_expm1f (xs[j]);
+  for (int j = 0; j < EXPM1F_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_expm1f(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_expm1f_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + EXPM1F_N_LANES <= n; k += EXPM1F_N_LANES)
+    expm1f_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_expm1f (x[k]);
+}
@@ -24,6 +24,7 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 #include <math.h>
@@ -75,7 +76,10 @@ static double as_ln(double x){
   return e*0x1.62e42fefa39efp-1 + il[i] + z*((c[0] + z*c[1]) + z2*(c[2] + z*c[3]) + z4*((c[4] + z*c[5]) + z2*(c[6] + z*c[7])));
 }
 
-float cr_lgammaf(float x){
+/* Same as cr_lgammaf(), but the sign of Gamma(x) is stored in *sign instead
+   of signgam.  As for signgam, *sign is not written when x is NaN or a
+   pole (x a non-positive integer). */
+static inline float as_lgammaf(float x, int *sign){
   static const struct {b32u32_u x; float f, df;} tb[] = {
     {{.f = -0x1.efc2a2p+14}, -0x1.222dbcp+18, -0x1p-7},
     {{.f = -0x1.627346p+7}, -0x1.73235ep+9, -0x1p-16},
@@ -118,7 +122,7 @@ float cr_lgammaf(float x){
   b32u32_u t = {.f = ax};
   if(__builtin_expect(t.u>=(0xffu<<23), 0)){
     if(t.u==(0xffu<<23)){ // +-inf
-      signgam = 1;
+      *sign = 1;
       return __builtin_inff();
     }
     return x; // nan
@@ -129,13 +133,13 @@ float cr_lgammaf(float x){
       return 1.0f/0.0f;
     }
     if(x==1.0f || x==2.0f) {
-      signgam = 1;
+      *sign = 1;
       return 0.0f;
     }
   }
   
   int k = fx;
-  signgam = 1 - (((k&(k>>31))&1)<<1);
+  *sign = 1 - (((k&(k>>31))&1)<<1);
   double z = ax, f;
   if(__builtin_expect(ax<0x1.52p-1f, 0)){
     static const double rn[] =
@@ -231,3 +235,22 @@ float cr_lgammaf(float x){
   }
   return r;
 }
+
+float cr_lgammaf(float x){
+  return as_lgammaf(x, &signgam);
+}
+
+/* Reentrant version of cr_lgammaf(): the sign of Gamma(x) is stored in *sign
+   and signgam is left unchanged.  When x is NaN or a pole, *sign is 1. */
+float cr_lgammaf_r(float x, int *sign){
+  *sign = 1;
+  return as_lgammaf(x, sign);
+}
+
+/* Sets y[k] = cr_lgammaf_r(x[k], &sign[k]) for 0 <= k < n.  x and y may be
+   equal.  Since signgam is not written, concurrent calls on distinct arrays
+   do not share any state. */
+void cr_lgammaf_n(const float *x, float *y, int *sign, size_t n){
+  for(size_t k=0;k<n;k++)
+    y[k] = cr_lgammaf_r(x[k], sign + k);
+}
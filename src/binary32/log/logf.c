@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -54,43 +59,45 @@ static __attribute__((noinline)) float as_special(float x){
   return 0.0f/0.0f; // to raise FE_INVALID and return nan
 }
 
+// shared by cr_logf() and cr_logf_n()
+static const double tr[] = {
+  0x1p+0, 0x1.f81f82p-1, 0x1.f07c1fp-1, 0x1.e9131acp-1,
+  0x1.e1e1e1ep-1, 0x1.dae6077p-1, 0x1.d41d41dp-1, 0x1.cd85689p-1,
+  0x1.c71c71cp-1, 0x1.c0e0704p-1, 0x1.bacf915p-1, 0x1.b4e81b5p-1,
+  0x1.af286bdp-1, 0x1.a98ef6p-1, 0x1.a41a41ap-1, 0x1.9ec8e95p-1,
+  0x1.999999ap-1, 0x1.948b0fdp-1, 0x1.8f9c19p-1, 0x1.8acb90fp-1,
+  0x1.8618618p-1, 0x1.8181818p-1, 0x1.7d05f41p-1, 0x1.78a4c81p-1,
+  0x1.745d174p-1, 0x1.702e05cp-1, 0x1.6c16c17p-1, 0x1.6816817p-1,
+  0x1.642c859p-1, 0x1.605816p-1, 0x1.5c9882cp-1, 0x1.58ed231p-1,
+  0x1.5555555p-1, 0x1.51d07ebp-1, 0x1.4e5e0a7p-1, 0x1.4afd6ap-1,
+  0x1.47ae148p-1, 0x1.446f865p-1, 0x1.4141414p-1, 0x1.3e22cbdp-1,
+  0x1.3b13b14p-1, 0x1.3813814p-1, 0x1.3521cfbp-1, 0x1.323e34ap-1,
+  0x1.2f684bep-1, 0x1.2c9fb4ep-1, 0x1.29e412ap-1, 0x1.27350b9p-1,
+  0x1.2492492p-1, 0x1.21fb781p-1, 0x1.1f7047ep-1, 0x1.1cf06aep-1,
+  0x1.1a7b961p-1, 0x1.1811812p-1, 0x1.15b1e5fp-1, 0x1.135c811p-1,
+  0x1.1111111p-1, 0x1.0ecf56cp-1, 0x1.0c9715p-1, 0x1.0a6810ap-1,
+  0x1.0842108p-1, 0x1.0624dd3p-1, 0x1.041041p-1, 0x1.0204081p-1, 0.5};
+static const double tl[] = {
+  -0x1.3b40815cd0628p-45, 0x1.fc0a890fbb514p-7, 0x1.f829b1e780b98p-6, 0x1.77458f532c948p-5,
+  0x1.f0a30c2114ef2p-5, 0x1.341d793bbc7f7p-4, 0x1.6f0d28d256172p-4, 0x1.a926d3a6acb89p-4,
+  0x1.e2707722ae90cp-4, 0x1.0d77e7a90896cp-3, 0x1.29552f6fff036p-3, 0x1.44d2b6c5b7831p-3,
+  0x1.5ff306ee78ee7p-3, 0x1.7ab890410d41cp-3, 0x1.9525a9e3451c7p-3, 0x1.af3c94ed0bb06p-3,
+  0x1.c8ff7c59a9535p-3, 0x1.e27076d5aedf9p-3, 0x1.fb9186b5e393ep-3, 0x1.0a324e38b8e6dp-2,
+  0x1.1675cacaba398p-2, 0x1.22941fc0f76efp-2, 0x1.2e8e2bc311abap-2, 0x1.3a64c56b14373p-2,
+  0x1.4618bc31c5c4cp-2, 0x1.51aad874df5b7p-2, 0x1.5d1bdbea80754p-2, 0x1.686c81d331238p-2,
+  0x1.739d7f6dbcd9p-2, 0x1.7eaf83c82ad4dp-2, 0x1.89a3385813fe4p-2, 0x1.947941aa91484p-2,
+  0x1.9f323edbf95d5p-2, 0x1.a9cec9a4205d3p-2, 0x1.b44f77c5c8cecp-2, 0x1.beb4d9ea71905p-2,
+  0x1.c8ff7c69a97abp-2, 0x1.d32fe7f38e95fp-2, 0x1.dd46a0501c22ap-2, 0x1.e7442617e8511p-2,
+  0x1.f128f5eaf0476p-2, 0x1.faf588dd8f0a8p-2, 0x1.02552a5edcfc4p-1, 0x1.0723e5c64de05p-1,
+  0x1.0be72e3852947p-1, 0x1.109f39d554b5cp-1, 0x1.154c3d2c4d4aep-1, 0x1.19ee6b38bc834p-1,
+  0x1.1e85f5ef03f95p-1, 0x1.23130d7fabe07p-1, 0x1.2795e1219afep-1, 0x1.2c0e9ec9c8d5p-1,
+  0x1.307d7337f0f83p-1, 0x1.34e289cb4e098p-1, 0x1.393e0d42e28dep-1, 0x1.3d9026ad555bfp-1,
+  0x1.41d8fe8667173p-1, 0x1.4618bc1ec5d87p-1, 0x1.4a4f85d303d8p-1, 0x1.4e7d8127f5a75p-1,
+  0x1.52a2d26dbc47p-1, 0x1.56bf9d597f25ep-1, 0x1.5ad404cb59df2p-1, 0x1.5ee02a928153ap-1,
+  0x1.62e42fefa38b4p-1};
+static const double b[] = {0x1.00000006342eap+0, -0x1.0001f7fdc3977p-1, 0x1.554a4e5cae9cfp-2};
+
 float cr_logf(float x){
-  static const double tr[] = {
-    0x1p+0, 0x1.f81f82p-1, 0x1.f07c1fp-1, 0x1.e9131acp-1,
-    0x1.e1e1e1ep-1, 0x1.dae6077p-1, 0x1.d41d41dp-1, 0x1.cd85689p-1,
-    0x1.c71c71cp-1, 0x1.c0e0704p-1, 0x1.bacf915p-1, 0x1.b4e81b5p-1,
-    0x1.af286bdp-1, 0x1.a98ef6p-1, 0x1.a41a41ap-1, 0x1.9ec8e95p-1,
-    0x1.999999ap-1, 0x1.948b0fdp-1, 0x1.8f9c19p-1, 0x1.8acb90fp-1,
-    0x1.8618618p-1, 0x1.8181818p-1, 0x1.7d05f41p-1, 0x1.78a4c81p-1,
-    0x1.745d174p-1, 0x1.702e05cp-1, 0x1.6c16c17p-1, 0x1.6816817p-1,
-    0x1.642c859p-1, 0x1.605816p-1, 0x1.5c9882cp-1, 0x1.58ed231p-1,
-    0x1.5555555p-1, 0x1.51d07ebp-1, 0x1.4e5e0a7p-1, 0x1.4afd6ap-1,
-    0x1.47ae148p-1, 0x1.446f865p-1, 0x1.4141414p-1, 0x1.3e22cbdp-1,
-    0x1.3b13b14p-1, 0x1.3813814p-1, 0x1.3521cfbp-1, 0x1.323e34ap-1,
-    0x1.2f684bep-1, 0x1.2c9fb4ep-1, 0x1.29e412ap-1, 0x1.27350b9p-1,
-    0x1.2492492p-1, 0x1.21fb781p-1, 0x1.1f7047ep-1, 0x1.1cf06aep-1,
-    0x1.1a7b961p-1, 0x1.1811812p-1, 0x1.15b1e5fp-1, 0x1.135c811p-1,
-    0x1.1111111p-1, 0x1.0ecf56cp-1, 0x1.0c9715p-1, 0x1.0a6810ap-1,
-    0x1.0842108p-1, 0x1.0624dd3p-1, 0x1.041041p-1, 0x1.0204081p-1, 0.5};
-  static const double tl[] = {
-    -0x1.3b40815cd0628p-45, 0x1.fc0a890fbb514p-7, 0x1.f829b1e780b98p-6, 0x1.77458f532c948p-5,
-    0x1.f0a30c2114ef2p-5, 0x1.341d793bbc7f7p-4, 0x1.6f0d28d256172p-4, 0x1.a926d3a6acb89p-4,
-    0x1.e2707722ae90cp-4, 0x1.0d77e7a90896cp-3, 0x1.29552f6fff036p-3, 0x1.44d2b6c5b7831p-3,
-    0x1.5ff306ee78ee7p-3, 0x1.7ab890410d41cp-3, 0x1.9525a9e3451c7p-3, 0x1.af3c94ed0bb06p-3,
-    0x1.c8ff7c59a9535p-3, 0x1.e27076d5aedf9p-3, 0x1.fb9186b5e393ep-3, 0x1.0a324e38b8e6dp-2,
-    0x1.1675cacaba398p-2, 0x1.22941fc0f76efp-2, 0x1.2e8e2bc311abap-2, 0x1.3a64c56b14373p-2,
-    0x1.4618bc31c5c4cp-2, 0x1.51aad874df5b7p-2, 0x1.5d1bdbea80754p-2, 0x1.686c81d331238p-2,
-    0x1.739d7f6dbcd9p-2, 0x1.7eaf83c82ad4dp-2, 0x1.89a3385813fe4p-2, 0x1.947941aa91484p-2,
-    0x1.9f323edbf95d5p-2, 0x1.a9cec9a4205d3p-2, 0x1.b44f77c5c8cecp-2, 0x1.beb4d9ea71905p-2,
-    0x1.c8ff7c69a97abp-2, 0x1.d32fe7f38e95fp-2, 0x1.dd46a0501c22ap-2, 0x1.e7442617e8511p-2,
-    0x1.f128f5eaf0476p-2, 0x1.faf588dd8f0a8p-2, 0x1.02552a5edcfc4p-1, 0x1.0723e5c64de05p-1,
-    0x1.0be72e3852947p-1, 0x1.109f39d554b5cp-1, 0x1.154c3d2c4d4aep-1, 0x1.19ee6b38bc834p-1,
-    0x1.1e85f5ef03f95p-1, 0x1.23130d7fabe07p-1, 0x1.2795e1219afep-1, 0x1.2c0e9ec9c8d5p-1,
-    0x1.307d7337f0f83p-1, 0x1.34e289cb4e098p-1, 0x1.393e0d42e28dep-1, 0x1.3d9026ad555bfp-1,
-    0x1.41d8fe8667173p-1, 0x1.4618bc1ec5d87p-1, 0x1.4a4f85d303d8p-1, 0x1.4e7d8127f5a75p-1,
-    0x1.52a2d26dbc47p-1, 0x1.56bf9d597f25ep-1, 0x1.5ad404cb59df2p-1, 0x1.5ee02a928153ap-1,
-    0x1.62e42fefa38b4p-1};
-  static const double b[] = {0x1.00000006342eap+0, -0x1.0001f7fdc3977p-1, 0x1.554a4e5cae9cfp-2};
   static const double c[] =
     {-0x1p-1, 0x1.55555555571cap-2, -0x1.0000000002d85p-2, 0x1.9999987d0c963p-3,
      -0x1.555554059a8bbp-3, 0x1.24aebcf71a38fp-3, -0x1.001c73915d758p-3};
@@ -129,3 +136,80 @@ float cr_logf(float x){
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_logf_n(). */
+#define LOGF_N_LANES 8
+
+/* Same as the fast path of cr_logf() on the 4 lanes of x, with the tr[] and
+   tl[] lookups done by gathers.  The operations are those of cr_logf(), in
+   the same order, thus each lane of y is bit-identical to cr_logf(x) when
+   the rounding test succeeds.  Return the mask of the lanes where x is
+   positive and normal, and for which the rounding test succeeds. */
+static inline unsigned
+logf_fast_avx2 (float *y, __m128 x)
+{
+  // 1<<23 <= ux < 0x7f800000
+  __m128i ux = _mm_castps_si128 (x);
+  __m128i v = _mm_sub_epi32 (ux, _mm_set1_epi32 (1 << 23));
+  __m128i lim = _mm_set1_epi32 (0x7f800000 - (1 << 23) - 1);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // 1 is a dummy argument for the special lanes
+  ux = _mm_blendv_epi8 (_mm_set1_epi32 (0x3f800000), ux, in);
+
+  __m128i m = _mm_and_si128 (ux, _mm_set1_epi32 ((1 << 23) - 1));
+  __m128i j = _mm_srli_epi32 (_mm_add_epi32 (m, _mm_set1_epi32 (1 << 16)), 17);
+  __m256d e = _mm256_cvtepi32_pd (_mm_sub_epi32 (_mm_srli_epi32 (ux, 23),
+                                                 _mm_set1_epi32 (127)));
+  __m256d tz = _mm256_castsi256_pd (_mm256_or_si256 (
+    _mm256_slli_epi64 (_mm256_cvtepu32_epi64 (m), 52 - 23),
+    _mm256_set1_epi64x (1023ll << 52)));
+  __m256d z = _mm256_sub_pd (_mm256_mul_pd (tz, _mm256_i32gather_pd (tr, j, 8)),
+                             _mm256_set1_pd (1.0));
+  __m256d z2 = _mm256_mul_pd (z, z);
+  __m256d r = _mm256_add_pd (
+    _mm256_mul_pd (e, _mm256_set1_pd (0x1.62e42fefa39efp-1)),
+    _mm256_i32gather_pd (tl, j, 8));
+  r = _mm256_add_pd (r, _mm256_mul_pd (z, _mm256_set1_pd (b[0])));
+  r = _mm256_add_pd (r, _mm256_mul_pd (z2, _mm256_add_pd (
+    _mm256_set1_pd (b[1]), _mm256_mul_pd (z, _mm256_set1_pd (b[2])))));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_add_pd (r, _mm256_set1_pd (0x1.f06p-33)));
+  _mm_storeu_ps (y, ub);
+  __m128 ok = _mm_and_ps (_mm_cmpeq_ps (ub, lb), _mm_castsi128_ps (in));
+  return _mm_movemask_ps (ok);
+}
+
+/* Evaluate logf on the LOGF_N_LANES values of x, four at a time.  The
+   special arguments (x <= 0, subnormal, infinite or NaN) and those for which
+   the rounding test fails go through cr_logf(). */
+static void
+logf_n_block (const float *x, float *y)
+{
+  float xs[LOGF_N_LANES], ys[LOGF_N_LANES];
+  for (int j = 0; j < LOGF_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < LOGF_N_LANES; j += 4)
+    ok |= logf_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << LOGF_N_LANES) - 1, 0))
+    for (int j = 0; j < LOGF_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_logf (xs[j]);
+  for (int j = 0; j < LOGF_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_logf(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_logf_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + LOGF_N_LANES <= n; k += LOGF_N_LANES)
+    logf_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_logf (x[k]);
+}
@@ -24,10 +24,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 #include <fenv.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -54,49 +59,51 @@ static __attribute__((noinline)) float as_special(float x){
   return __builtin_nanf("<0"); // to raise FE_DIVBYZERO
 }
 
+// shared by cr_log10f() and cr_log10f_n()
+static const double tr[] = {
+  0x1p+0, 0x1.f81f82p-1, 0x1.f07c1fp-1, 0x1.e9131acp-1,
+  0x1.e1e1e1ep-1, 0x1.dae6077p-1, 0x1.d41d41dp-1, 0x1.cd85689p-1,
+  0x1.c71c71cp-1, 0x1.c0e0704p-1, 0x1.bacf915p-1, 0x1.b4e81b5p-1,
+  0x1.af286bdp-1, 0x1.a98ef6p-1, 0x1.a41a41ap-1, 0x1.9ec8e95p-1,
+  0x1.999999ap-1, 0x1.948b0fdp-1, 0x1.8f9c19p-1, 0x1.8acb90fp-1,
+  0x1.8618618p-1, 0x1.8181818p-1, 0x1.7d05f41p-1, 0x1.78a4c81p-1,
+  0x1.745d174p-1, 0x1.702e05cp-1, 0x1.6c16c17p-1, 0x1.6816817p-1,
+  0x1.642c859p-1, 0x1.605816p-1, 0x1.5c9882cp-1, 0x1.58ed231p-1,
+  0x1.5555555p-1, 0x1.51d07ebp-1, 0x1.4e5e0a7p-1, 0x1.4afd6ap-1,
+  0x1.47ae148p-1, 0x1.446f865p-1, 0x1.4141414p-1, 0x1.3e22cbdp-1,
+  0x1.3b13b14p-1, 0x1.3813814p-1, 0x1.3521cfbp-1, 0x1.323e34ap-1,
+  0x1.2f684bep-1, 0x1.2c9fb4ep-1, 0x1.29e412ap-1, 0x1.27350b9p-1,
+  0x1.2492492p-1, 0x1.21fb781p-1, 0x1.1f7047ep-1, 0x1.1cf06aep-1,
+  0x1.1a7b961p-1, 0x1.1811812p-1, 0x1.15b1e5fp-1, 0x1.135c811p-1,
+  0x1.1111111p-1, 0x1.0ecf56cp-1, 0x1.0c9715p-1, 0x1.0a6810ap-1,
+  0x1.0842108p-1, 0x1.0624dd3p-1, 0x1.041041p-1, 0x1.0204081p-1,
+  0.5};
+static const double tl[] = {
+  -0x1.d45fd6237ebe3p-47, 0x1.b947689311b6ep-8, 0x1.b5e909c96d7d5p-7, 0x1.45f4f59ed2165p-6,
+  0x1.af5f92cbd8f1ep-6, 0x1.0ba01a606de8cp-5, 0x1.3ed119b9a2b7bp-5, 0x1.714834298eec2p-5,
+  0x1.a30a9d98357fbp-5, 0x1.d41d512670813p-5, 0x1.02428c0f65519p-4, 0x1.1a23444eecc3ep-4,
+  0x1.31b30543f4cb4p-4, 0x1.48f3ed39bfd04p-4, 0x1.5fe8049a0e423p-4, 0x1.769140a6aa008p-4,
+  0x1.8cf1836c98cb3p-4, 0x1.a30a9d55541a1p-4, 0x1.b8de4d1ee823ep-4, 0x1.ce6e4202ca2e6p-4,
+  0x1.e3bc1accace07p-4, 0x1.f8c9683b5abd4p-4, 0x1.06cbd68ca9a6ep-3, 0x1.11142f19df73p-3,
+  0x1.1b3e71fa7a97fp-3, 0x1.254b4d37a46e3p-3, 0x1.2f3b6912cbf07p-3, 0x1.390f683115886p-3,
+  0x1.42c7e7fffc5a8p-3, 0x1.4c65808c78d3cp-3, 0x1.55e8c50751c55p-3, 0x1.5f52445dec3d8p-3,
+  0x1.68a288c3f12p-3, 0x1.71da17bdf0d19p-3, 0x1.7af973608afd9p-3, 0x1.84011952a2579p-3,
+  0x1.8cf1837a7ea6p-3, 0x1.95cb2891e43d6p-3, 0x1.9e8e7b0f869ep-3, 0x1.a73beaa5db18dp-3,
+  0x1.afd3e394558d3p-3, 0x1.b856cf060d9f1p-3, 0x1.c0c5134de1ffcp-3, 0x1.c91f1371bc99fp-3,
+  0x1.d1652ffcd3f53p-3, 0x1.d997c6f635e75p-3, 0x1.e1b733ab90f3bp-3, 0x1.e9c3ceadac856p-3,
+  0x1.f1bdeec43a305p-3, 0x1.f9a5e7a5fa3fep-3, 0x1.00be05ac02f2bp-2, 0x1.04a054d81a2d4p-2,
+  0x1.087a0835957fbp-2, 0x1.0c4b457099517p-2, 0x1.101431aa1fe51p-2, 0x1.13d4f08b98dd8p-2,
+  0x1.178da53edb892p-2, 0x1.1b3e71e9f9d58p-2, 0x1.1ee777defdeedp-2, 0x1.2288d7b48e23bp-2,
+  0x1.2622b0f52e49fp-2, 0x1.29b522a4c6314p-2, 0x1.2d404b0e30f8p-2, 0x1.30c4478f3fbe5p-2,
+  0x1.34413509f7915p-2};
+static const union{float f; uint32_t u;} st[] = {
+ {0x1p+0}, {0x1.4p+3}, {0x1.9p+6}, {0x1.f4p+9},
+ {0x1.388p+13}, {0x1.86ap+16}, {0x1.e848p+19}, {0x1.312dp+23},
+ {0x1.7d784p+26}, {0x1.dcd65p+29}, {0x1.2a05f2p+33}, {0},
+ {0}, {0}, {0}, {0}};
+static const double b[] = {0x1.bcb7b15c5a2f8p-2, -0x1.bcbb1dbb88ebap-3, 0x1.2871c39d521c6p-3};
+
 float cr_log10f(float x){
-  static const double tr[] = {
-    0x1p+0, 0x1.f81f82p-1, 0x1.f07c1fp-1, 0x1.e9131acp-1,
-    0x1.e1e1e1ep-1, 0x1.dae6077p-1, 0x1.d41d41dp-1, 0x1.cd85689p-1,
-    0x1.c71c71cp-1, 0x1.c0e0704p-1, 0x1.bacf915p-1, 0x1.b4e81b5p-1,
-    0x1.af286bdp-1, 0x1.a98ef6p-1, 0x1.a41a41ap-1, 0x1.9ec8e95p-1,
-    0x1.999999ap-1, 0x1.948b0fdp-1, 0x1.8f9c19p-1, 0x1.8acb90fp-1,
-    0x1.8618618p-1, 0x1.8181818p-1, 0x1.7d05f41p-1, 0x1.78a4c81p-1,
-    0x1.745d174p-1, 0x1.702e05cp-1, 0x1.6c16c17p-1, 0x1.6816817p-1,
-    0x1.642c859p-1, 0x1.605816p-1, 0x1.5c9882cp-1, 0x1.58ed231p-1,
-    0x1.5555555p-1, 0x1.51d07ebp-1, 0x1.4e5e0a7p-1, 0x1.4afd6ap-1,
-    0x1.47ae148p-1, 0x1.446f865p-1, 0x1.4141414p-1, 0x1.3e22cbdp-1,
-    0x1.3b13b14p-1, 0x1.3813814p-1, 0x1.3521cfbp-1, 0x1.323e34ap-1,
-    0x1.2f684bep-1, 0x1.2c9fb4ep-1, 0x1.29e412ap-1, 0x1.27350b9p-1,
-    0x1.2492492p-1, 0x1.21fb781p-1, 0x1.1f7047ep-1, 0x1.1cf06aep-1,
-    0x1.1a7b961p-1, 0x1.1811812p-1, 0x1.15b1e5fp-1, 0x1.135c811p-1,
-    0x1.1111111p-1, 0x1.0ecf56cp-1, 0x1.0c9715p-1, 0x1.0a6810ap-1,
-    0x1.0842108p-1, 0x1.0624dd3p-1, 0x1.041041p-1, 0x1.0204081p-1,
-    0.5};
-  static const double tl[] = {
-    -0x1.d45fd6237ebe3p-47, 0x1.b947689311b6ep-8, 0x1.b5e909c96d7d5p-7, 0x1.45f4f59ed2165p-6,
-    0x1.af5f92cbd8f1ep-6, 0x1.0ba01a606de8cp-5, 0x1.3ed119b9a2b7bp-5, 0x1.714834298eec2p-5,
-    0x1.a30a9d98357fbp-5, 0x1.d41d512670813p-5, 0x1.02428c0f65519p-4, 0x1.1a23444eecc3ep-4,
-    0x1.31b30543f4cb4p-4, 0x1.48f3ed39bfd04p-4, 0x1.5fe8049a0e423p-4, 0x1.769140a6aa008p-4,
-    0x1.8cf1836c98cb3p-4, 0x1.a30a9d55541a1p-4, 0x1.b8de4d1ee823ep-4, 0x1.ce6e4202ca2e6p-4,
-    0x1.e3bc1accace07p-4, 0x1.f8c9683b5abd4p-4, 0x1.06cbd68ca9a6ep-3, 0x1.11142f19df73p-3,
-    0x1.1b3e71fa7a97fp-3, 0x1.254b4d37a46e3p-3, 0x1.2f3b6912cbf07p-3, 0x1.390f683115886p-3,
-    0x1.42c7e7fffc5a8p-3, 0x1.4c65808c78d3cp-3, 0x1.55e8c50751c55p-3, 0x1.5f52445dec3d8p-3,
-    0x1.68a288c3f12p-3, 0x1.71da17bdf0d19p-3, 0x1.7af973608afd9p-3, 0x1.84011952a2579p-3,
-    0x1.8cf1837a7ea6p-3, 0x1.95cb2891e43d6p-3, 0x1.9e8e7b0f869ep-3, 0x1.a73beaa5db18dp-3,
-    0x1.afd3e394558d3p-3, 0x1.b856cf060d9f1p-3, 0x1.c0c5134de1ffcp-3, 0x1.c91f1371bc99fp-3,
-    0x1.d1652ffcd3f53p-3, 0x1.d997c6f635e75p-3, 0x1.e1b733ab90f3bp-3, 0x1.e9c3ceadac856p-3,
-    0x1.f1bdeec43a305p-3, 0x1.f9a5e7a5fa3fep-3, 0x1.00be05ac02f2bp-2, 0x1.04a054d81a2d4p-2,
-    0x1.087a0835957fbp-2, 0x1.0c4b457099517p-2, 0x1.101431aa1fe51p-2, 0x1.13d4f08b98dd8p-2,
-    0x1.178da53edb892p-2, 0x1.1b3e71e9f9d58p-2, 0x1.1ee777defdeedp-2, 0x1.2288d7b48e23bp-2,
-    0x1.2622b0f52e49fp-2, 0x1.29b522a4c6314p-2, 0x1.2d404b0e30f8p-2, 0x1.30c4478f3fbe5p-2,
-    0x1.34413509f7915p-2};
-  static const union{float f; uint32_t u;} st[] = {
-   {0x1p+0}, {0x1.4p+3}, {0x1.9p+6}, {0x1.f4p+9},
-   {0x1.388p+13}, {0x1.86ap+16}, {0x1.e848p+19}, {0x1.312dp+23},
-   {0x1.7d784p+26}, {0x1.dcd65p+29}, {0x1.2a05f2p+33}, {0},
-   {0}, {0}, {0}, {0}};
-  static const double b[] = {0x1.bcb7b15c5a2f8p-2, -0x1.bcbb1dbb88ebap-3, 0x1.2871c39d521c6p-3};
   static const double c[] =
     {0x1.bcb7b1526e50ep-2, -0x1.bcb7b1526e53dp-3, 0x1.287a7636f3fa2p-3, -0x1.bcb7b146a14b3p-4,
      0x1.63c627d5219cbp-4, -0x1.2880736c8762dp-4, 0x1.fc1ecf913961ap-5};
@@ -135,3 +142,87 @@ float cr_log10f(float x){
   }
   return ub;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_log10f_n(). */
+#define LOG10F_N_LANES 8
+
+/* Same as the fast path of cr_log10f() on the 4 lanes of x, with the table
+   lookups done by gathers.  The operations are those of cr_log10f(), in the
+   same order, thus each lane of y is bit-identical to cr_log10f(x) when x is
+   an exact power of 10 or the rounding test succeeds.  Return the mask of
+   the lanes where x is positive and normal, and which are in one of these
+   two cases. */
+static inline unsigned
+log10f_fast_avx2 (float *y, __m128 x)
+{
+  // 1<<23 <= ux < 0x7f800000
+  __m128i ux = _mm_castps_si128 (x);
+  __m128i v = _mm_sub_epi32 (ux, _mm_set1_epi32 (1 << 23));
+  __m128i lim = _mm_set1_epi32 (0x7f800000 - (1 << 23) - 1);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // 1 is a dummy argument for the special lanes
+  ux = _mm_blendv_epi8 (_mm_set1_epi32 (0x3f800000), ux, in);
+
+  __m128i m = _mm_and_si128 (ux, _mm_set1_epi32 ((1 << 23) - 1));
+  __m128i j = _mm_srli_epi32 (_mm_add_epi32 (m, _mm_set1_epi32 (1 << 16)), 17);
+  __m128i ei = _mm_sub_epi32 (_mm_srli_epi32 (ux, 23), _mm_set1_epi32 (127));
+  __m128i je = _mm_srli_epi32 (_mm_mullo_epi32 (
+    _mm_add_epi32 (ei, _mm_set1_epi32 (1)), _mm_set1_epi32 (0x4d104d4)), 28);
+  __m128i exact = _mm_cmpeq_epi32 (ux, _mm_i32gather_epi32 (
+    (const int *) st, je, 4));
+  __m256d e = _mm256_cvtepi32_pd (ei);
+  __m256d tz = _mm256_castsi256_pd (_mm256_or_si256 (
+    _mm256_slli_epi64 (_mm256_cvtepu32_epi64 (m), 52 - 23),
+    _mm256_set1_epi64x (1023ll << 52)));
+  __m256d z = _mm256_sub_pd (_mm256_mul_pd (tz, _mm256_i32gather_pd (tr, j, 8)),
+                             _mm256_set1_pd (1.0));
+  __m256d z2 = _mm256_mul_pd (z, z);
+  __m256d r = _mm256_add_pd (
+    _mm256_mul_pd (e, _mm256_set1_pd (0x1.34413509f79ffp-2)),
+    _mm256_i32gather_pd (tl, j, 8));
+  r = _mm256_add_pd (r, _mm256_mul_pd (z, _mm256_set1_pd (b[0])));
+  r = _mm256_add_pd (r, _mm256_mul_pd (z2, _mm256_add_pd (
+    _mm256_set1_pd (b[1]), _mm256_mul_pd (z, _mm256_set1_pd (b[2])))));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_add_pd (r, _mm256_set1_pd (0x1.b008p-34)));
+  __m128 ok = _mm_or_ps (_mm_cmpeq_ps (ub, lb), _mm_castsi128_ps (exact));
+  ub = _mm_blendv_ps (ub, _mm_cvtepi32_ps (je), _mm_castsi128_ps (exact));
+  _mm_storeu_ps (y, ub);
+  ok = _mm_and_ps (ok, _mm_castsi128_ps (in));
+  return _mm_movemask_ps (ok);
+}
+
+/* Evaluate log10f on the LOG10F_N_LANES values of x, four at a time.  The
+   special arguments (x <= 0, subnormal, infinite or NaN) and those for which
+   the rounding test fails go through cr_log10f(). */
+static void
+log10f_n_block (const float *x, float *y)
+{
+  float xs[LOG10F_N_LANES], ys[LOG10F_N_LANES];
+  for (int j = 0; j < LOG10F_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < LOG10F_N_LANES; j += 4)
+    ok |= log10f_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << LOG10F_N_LANES) - 1, 0))
+    for (int j = 0; j < LOG10F_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_log10f (xs[j]);
+  for (int j = 0; j < LOG10F_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_log10f(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_log10f_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + LOG10F_N_LANES <= n; k += LOG10F_N_LANES)
+    log10f_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_log10f (x[k]);
+}
@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -50,23 +55,30 @@ static __attribute__((noinline)) float as_special(float x){
   return 0.0f/0.0f; // to raise FE_INVALID
 }
 
+// shared by cr_log1pf() and cr_log1pf_n()
+static const double x0[] = {
+  0x1.f81f82p-1, 0x1.e9131acp-1, 0x1.dae6077p-1, 0x1.cd85689p-1, 0x1.c0e0704p-1, 0x1.b4e81b5p-1,
+  0x1.a98ef6p-1, 0x1.9ec8e95p-1, 0x1.948b0fdp-1, 0x1.8acb90fp-1, 0x1.8181818p-1, 0x1.78a4c81p-1,
+  0x1.702e05cp-1, 0x1.6816817p-1, 0x1.605816p-1, 0x1.58ed231p-1, 0x1.51d07ebp-1, 0x1.4afd6ap-1,
+  0x1.446f865p-1, 0x1.3e22cbdp-1, 0x1.3813814p-1, 0x1.323e34ap-1, 0x1.2c9fb4ep-1, 0x1.27350b9p-1,
+  0x1.21fb781p-1, 0x1.1cf06aep-1, 0x1.1811812p-1, 0x1.135c811p-1, 0x1.0ecf56cp-1, 0x1.0a6810ap-1,
+  0x1.0624dd3p-1, 0x1.0204081p-1};
+static const double lixb[] = {
+  0x1.fc0a8909b4218p-7, 0x1.77458f51aac89p-5, 0x1.341d793afb997p-4, 0x1.a926d3a5ebd2ap-4,
+  0x1.0d77e7a8a823dp-3, 0x1.44d2b6c557102p-3, 0x1.7ab89040accecp-3, 0x1.af3c94ecab3d6p-3,
+  0x1.e27076d54e6c9p-3, 0x1.0a324e3888ad5p-2, 0x1.22941fc0c7357p-2, 0x1.3a64c56ae3fdbp-2,
+  0x1.51aad874af21fp-2, 0x1.686c81d300eap-2, 0x1.7eaf83c7fa9b5p-2, 0x1.947941aa610ecp-2,
+  0x1.a9cec9a3f023bp-2, 0x1.beb4d9ea4156ep-2, 0x1.d32fe7f35e5c7p-2, 0x1.e7442617b817ap-2,
+  0x1.faf588dd5ed1p-2, 0x1.0723e5c635c39p-1, 0x1.109f39d53c99p-1, 0x1.19ee6b38a4668p-1,
+  0x1.23130d7f93c3bp-1, 0x1.2c0e9ec9b0b85p-1, 0x1.34e289cb35eccp-1, 0x1.3d9026ad3d3f3p-1,
+  0x1.4618bc1eadbbbp-1, 0x1.4e7d8127dd8a9p-1, 0x1.56bf9d5967092p-1, 0x1.5ee02a926936ep-1};
+static const double b[] =
+  {0x1p+0, -0x1p-1, 0x1.5555555556f6bp-2, -0x1.00000000029b9p-2,
+   0x1.9999988d176e4p-3, -0x1.55555418889a7p-3, 0x1.24adeca50e2bcp-3, -0x1.001ba33bf57cfp-3};
+static const double c[] =
+  {-0x1.3902c33434e7fp-43, 0x1.ffffffe1cbed5p-1, -0x1.ffffff7d1b014p-2, 0x1.5564e0ed3613ap-2, -0x1.0012232a00d4ap-2};
+
 float cr_log1pf(float x) {
-  static const double x0[] = {
-    0x1.f81f82p-1, 0x1.e9131acp-1, 0x1.dae6077p-1, 0x1.cd85689p-1, 0x1.c0e0704p-1, 0x1.b4e81b5p-1,
-    0x1.a98ef6p-1, 0x1.9ec8e95p-1, 0x1.948b0fdp-1, 0x1.8acb90fp-1, 0x1.8181818p-1, 0x1.78a4c81p-1,
-    0x1.702e05cp-1, 0x1.6816817p-1, 0x1.605816p-1, 0x1.58ed231p-1, 0x1.51d07ebp-1, 0x1.4afd6ap-1,
-    0x1.446f865p-1, 0x1.3e22cbdp-1, 0x1.3813814p-1, 0x1.323e34ap-1, 0x1.2c9fb4ep-1, 0x1.27350b9p-1,
-    0x1.21fb781p-1, 0x1.1cf06aep-1, 0x1.1811812p-1, 0x1.135c811p-1, 0x1.0ecf56cp-1, 0x1.0a6810ap-1,
-    0x1.0624dd3p-1, 0x1.0204081p-1};
-  static const double lixb[] = {
-    0x1.fc0a8909b4218p-7, 0x1.77458f51aac89p-5, 0x1.341d793afb997p-4, 0x1.a926d3a5ebd2ap-4,
-    0x1.0d77e7a8a823dp-3, 0x1.44d2b6c557102p-3, 0x1.7ab89040accecp-3, 0x1.af3c94ecab3d6p-3,
-    0x1.e27076d54e6c9p-3, 0x1.0a324e3888ad5p-2, 0x1.22941fc0c7357p-2, 0x1.3a64c56ae3fdbp-2,
-    0x1.51aad874af21fp-2, 0x1.686c81d300eap-2, 0x1.7eaf83c7fa9b5p-2, 0x1.947941aa610ecp-2,
-    0x1.a9cec9a3f023bp-2, 0x1.beb4d9ea4156ep-2, 0x1.d32fe7f35e5c7p-2, 0x1.e7442617b817ap-2,
-    0x1.faf588dd5ed1p-2, 0x1.0723e5c635c39p-1, 0x1.109f39d53c99p-1, 0x1.19ee6b38a4668p-1,
-    0x1.23130d7f93c3bp-1, 0x1.2c0e9ec9b0b85p-1, 0x1.34e289cb35eccp-1, 0x1.3d9026ad3d3f3p-1,
-    0x1.4618bc1eadbbbp-1, 0x1.4e7d8127dd8a9p-1, 0x1.56bf9d5967092p-1, 0x1.5ee02a926936ep-1};
   static const double lix[] = {
     0x1.fc0a890fc03e4p-7, 0x1.77458f532dcfcp-5, 0x1.341d793bbd1d1p-4, 0x1.a926d3a6ad563p-4,
     0x1.0d77e7a908e59p-3, 0x1.44d2b6c5b7d1ep-3, 0x1.7ab890410d909p-3, 0x1.af3c94ed0bff3p-3,
@@ -76,9 +88,6 @@ float cr_log1pf(float x) {
     0x1.faf588dd8f31fp-2, 0x1.0723e5c64df4p-1, 0x1.109f39d554c97p-1, 0x1.19ee6b38bc96fp-1,
     0x1.23130d7fabf43p-1, 0x1.2c0e9ec9c8e8cp-1, 0x1.34e289cb4e1d3p-1, 0x1.3d9026ad556fbp-1,
     0x1.4618bc1ec5ec2p-1, 0x1.4e7d8127f5bb1p-1, 0x1.56bf9d597f399p-1, 0x1.5ee02a9281675p-1};
-  static const double b[] =
-    {0x1p+0, -0x1p-1, 0x1.5555555556f6bp-2, -0x1.00000000029b9p-2,
-     0x1.9999988d176e4p-3, -0x1.55555418889a7p-3, 0x1.24adeca50e2bcp-3, -0x1.001ba33bf57cfp-3};
 
   double z = x;
   b32u32_u t = {.f = x};
@@ -99,8 +108,6 @@ float cr_log1pf(float x) {
     e -= 0x3ff;
     b64u64_u xd = {.u = m52 | (0x3fful<<52)};
     double z = xd.f*x0[j] - 1;
-    static const double c[] =
-      {-0x1.3902c33434e7fp-43, 0x1.ffffffe1cbed5p-1, -0x1.ffffff7d1b014p-2, 0x1.5564e0ed3613ap-2, -0x1.0012232a00d4ap-2};
     const double ln2 = 0x1.62e42fefa39efp-1;
     double z2 = z*z, r = (ln2*e + lixb[j]) + z*((c[1] + z*c[2]) + z2*(c[3] + z*c[4]));
     float ub = r, lb = r + 2.2e-11;
@@ -124,3 +131,121 @@ float cr_log1pf(float x) {
     return ub;
   }
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_log1pf_n(). */
+#define LOG1PF_N_LANES 8
+
+/* Same as cr_log1pf() on the 4 lanes of x, for 0x1p-25 <= |x| and -1 < x <
+   +inf, with the table lookups done by gathers.  The polynomial for |x| <
+   0x1.1p-6 and the fast path of the table-based evaluation are computed on
+   all lanes, and selected according to |x|.  The operations are those of
+   cr_log1pf(), in the same order, thus each lane of y is bit-identical to
+   cr_log1pf(x) when the rounding test succeeds (and, for |x| < 0x1.1p-6,
+   when no correction is needed).  Return the mask of the lanes in the
+   above range for which this is the case. */
+static inline unsigned
+log1pf_fast_avx2 (float *y, __m128 x)
+{
+  const double ln2 = 0x1.62e42fefa39efp-1;
+  __m128i ux = _mm_castps_si128 (x);
+  __m128i ax = _mm_and_si128 (ux, _mm_set1_epi32 (~0u >> 1));
+  // 0x33000000 <= ax < 0x3c880000
+  __m128i v = _mm_sub_epi32 (ax, _mm_set1_epi32 (0x33000000));
+  __m128i lim = _mm_set1_epi32 (0x3c880000 - 0x33000000 - 1);
+  __m128i small = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // 0x3c880000 <= ax, ux < 0xbf800000 and ax < 0x7f800000
+  lim = _mm_set1_epi32 (0x3c880000 - 1);
+  __m128i big = _mm_xor_si128 (_mm_cmpeq_epi32 (_mm_min_epu32 (ax, lim), ax),
+                               _mm_set1_epi32 (-1));
+  lim = _mm_set1_epi32 (0xbf800000 - 1);
+  big = _mm_and_si128 (big, _mm_cmpeq_epi32 (_mm_min_epu32 (ux, lim), ux));
+  big = _mm_and_si128 (big, _mm_cmpgt_epi32 (_mm_set1_epi32 (0x7f800000), ax));
+  // dummy arguments for the lanes outside each range
+  __m256d zs = _mm256_cvtps_pd (_mm_and_ps (x, _mm_castsi128_ps (small)));
+  __m256d z = _mm256_cvtps_pd (_mm_blendv_ps (_mm_set1_ps (1.0f), x,
+                                              _mm_castsi128_ps (big)));
+
+  // |x| < 0x1.1p-6
+  __m256d z2 = _mm256_mul_pd (zs, zs), z4 = _mm256_mul_pd (z2, z2), p[3];
+  for (int i = 0; i < 3; i++)
+    p[i] = _mm256_add_pd (_mm256_set1_pd (b[2 * i + 1]),
+                          _mm256_mul_pd (zs, _mm256_set1_pd (b[2 * i + 2])));
+  __m256d f = _mm256_add_pd (p[0], _mm256_mul_pd (z2, p[1]));
+  f = _mm256_add_pd (f, _mm256_mul_pd (z4, _mm256_add_pd (
+    p[2], _mm256_mul_pd (z2, _mm256_set1_pd (b[7])))));
+  f = _mm256_mul_pd (z2, f);
+  __m256d rs = _mm256_add_pd (zs, f);
+  // (r.u&0xfffffff) == 0 needs a correction
+  __m256i corr = _mm256_cmpeq_epi64 (_mm256_and_si256 (
+    _mm256_castpd_si256 (rs), _mm256_set1_epi64x (0xfffffff)),
+    _mm256_setzero_si256 ());
+  __m128 ys = _mm256_cvtpd_ps (rs);
+
+  // 0x1.1p-6 <= |x|
+  __m256i t = _mm256_castpd_si256 (_mm256_add_pd (z, _mm256_set1_pd (1.0)));
+  // e = (t.u>>52) - 0x3ff, computed as (2^52 + (t.u>>52)) - (2^52 + 0x3ff)
+  __m256d e = _mm256_sub_pd (_mm256_castsi256_pd (_mm256_or_si256 (
+    _mm256_srli_epi64 (t, 52), _mm256_set1_epi64x (0x4330000000000000))),
+    _mm256_set1_pd (0x1p52 + 0x3ff));
+  __m256i j = _mm256_and_si256 (_mm256_srli_epi64 (t, 52 - 5),
+                                _mm256_set1_epi64x (31));
+  __m256d xd = _mm256_castsi256_pd (_mm256_or_si256 (
+    _mm256_and_si256 (t, _mm256_set1_epi64x (~0ull >> 12)),
+    _mm256_set1_epi64x (0x3ffll << 52)));
+  z = _mm256_sub_pd (_mm256_mul_pd (xd, _mm256_i64gather_pd (x0, j, 8)),
+                     _mm256_set1_pd (1.0));
+  z2 = _mm256_mul_pd (z, z);
+  __m256d r = _mm256_add_pd (_mm256_mul_pd (_mm256_set1_pd (ln2), e),
+                             _mm256_i64gather_pd (lixb, j, 8));
+  __m256d q = _mm256_add_pd (_mm256_set1_pd (c[1]),
+                             _mm256_mul_pd (z, _mm256_set1_pd (c[2])));
+  q = _mm256_add_pd (q, _mm256_mul_pd (z2, _mm256_add_pd (
+    _mm256_set1_pd (c[3]), _mm256_mul_pd (z, _mm256_set1_pd (c[4])))));
+  r = _mm256_add_pd (r, _mm256_mul_pd (z, q));
+  __m128 ub = _mm256_cvtpd_ps (r);
+  __m128 lb = _mm256_cvtpd_ps (_mm256_add_pd (r, _mm256_set1_pd (2.2e-11)));
+
+  // 4 x 64-bit masks to 4 x 32-bit masks
+  __m128i corr32 = _mm256_castsi256_si128 (_mm256_permutevar8x32_epi32 (
+    corr, _mm256_setr_epi32 (0, 2, 4, 6, 0, 2, 4, 6)));
+  __m128i ok = _mm_or_si128 (
+    _mm_andnot_si128 (corr32, small),
+    _mm_and_si128 (_mm_castps_si128 (_mm_cmpeq_ps (ub, lb)), big));
+  _mm_storeu_ps (y, _mm_blendv_ps (ub, ys, _mm_castsi128_ps (small)));
+  return _mm_movemask_ps (_mm_castsi128_ps (ok));
+}
+
+/* Evaluate log1pf on the LOG1PF_N_LANES values of x, four at a time.  The
+   special arguments (tiny, x <= -1, infinite or NaN) and those for which the
+   rounding test fails go through cr_log1pf(). */
+static void
+log1pf_n_block (const float *x, float *y)
+{
+  float xs[LOG1PF_N_LANES], ys[LOG1PF_N_LANES];
+  for (int j = 0; j < LOG1PF_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0;
+  for (int j = 0; j < LOG1PF_N_LANES; j += 4)
+    ok |= log1pf_fast_avx2 (ys + j, _mm_loadu_ps (xs + j)) << j;
+  if (__builtin_expect (ok != (1u << LOG1PF_N_LANES) - 1, 0))
+    for (int j = 0; j < LOG1PF_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        ys[j] = cr_log1pf (xs[j]);
+  for (int j = 0; j < LOG1PF_N_LANES; j++)
+    y[j] = ys[j];
+}
+#endif
+
+/* Sets y[k] = cr_log1pf(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_log1pf_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  for (; k + LOG1PF_N_LANES <= n; k += LOG1PF_N_LANES)
+    log1pf_n_block (x + k, y + k);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_log1pf (x[k]);
+}
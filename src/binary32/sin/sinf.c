@@ -24,9 +24,14 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -205,3 +210,132 @@ float cr_sinf(float x){
   double r = s0 + aa*(z*c0) - bb*(z2*s0);
   return r;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_sinf_n(). */
+#define SINF_N_LANES 8
+/* Number of arguments cr_sinf_n() may leave to cr_sinf() before it
+   evaluates them. */
+#define SINF_N_QUEUE 64
+
+/* Same as cr_sinf() for 0x73000000 <= ax <= 0x99000000 on the 4 lanes of x:
+   the reductions rltl0() and rltl() are both computed and selected per lane,
+   and the tb[] lookups are gathers.  The operations are those of cr_sinf(),
+   in the same order, thus each lane of y is bit-identical to cr_sinf(x).
+   Return the mask of the lanes in that range, except the database
+   arguments. */
+static inline unsigned
+sinf_fast_avx2 (float *y, __m128 x)
+{
+  // 0x39800000 <= |ux| <= 0x4c800000, i.e., 0x73000000 <= ax <= 0x99000000
+  __m128i u = _mm_and_si128 (_mm_castps_si128 (x), _mm_set1_epi32 (0x7fffffff));
+  __m128i v = _mm_sub_epi32 (u, _mm_set1_epi32 (0x39800000));
+  __m128i lim = _mm_set1_epi32 (0x4c800000 - 0x39800000);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  __m128i db = _mm_or_si128 (
+    _mm_or_si128 (_mm_cmpeq_epi32 (u, _mm_set1_epi32 (0x7e75b8a2u >> 1)),
+                  _mm_cmpeq_epi32 (u, _mm_set1_epi32 (0x7f4f0654u >> 1))),
+    _mm_cmpeq_epi32 (u, _mm_set1_epi32 (0x8c333330u >> 1)));
+  in = _mm_andnot_si128 (db, in);
+  // 1 is a dummy argument for the other lanes
+  __m256d z0 = _mm256_cvtps_pd (_mm_blendv_ps (_mm_set1_ps (1.0f), x,
+                                               _mm_castsi128_ps (in)));
+
+  // rltl0() for ax < 0x822d97c8, rltl() otherwise
+  __m256d small = _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (
+    _mm_cmplt_epi32 (u, _mm_set1_epi32 (0x822d97c8u >> 1))));
+  __m256d idh0 = _mm256_mul_pd (_mm256_set1_pd (0x1.45f306dc9c883p+2), z0);
+  __m256d id0 = _mm256_round_pd (idh0, _MM_FROUND_TO_NEAREST_INT
+                                       | _MM_FROUND_NO_EXC);
+  __m256d idl = _mm256_mul_pd (_mm256_set1_pd (-0x1.b1bbead603d8bp-29), z0);
+  __m256d idh = _mm256_mul_pd (_mm256_set1_pd (0x1.45f306ep+2), z0);
+  __m256d id = _mm256_round_pd (idh, _MM_FROUND_TO_NEAREST_INT
+                                     | _MM_FROUND_NO_EXC);
+  __m256d z = _mm256_blendv_pd (
+    _mm256_add_pd (_mm256_sub_pd (idh, id), idl), _mm256_sub_pd (idh0, id0),
+    small);
+  // |id| < 2^29, thus the conversion is exact
+  __m128i ia = _mm256_cvtpd_epi32 (_mm256_blendv_pd (id, id0, small));
+
+  __m256d z2 = _mm256_mul_pd (z, z), z4 = _mm256_mul_pd (z2, z2);
+  __m256d aa = _mm256_add_pd (
+    _mm256_add_pd (_mm256_set1_pd (a[0]),
+                   _mm256_mul_pd (z2, _mm256_set1_pd (a[1]))),
+    _mm256_mul_pd (z4, _mm256_add_pd (_mm256_set1_pd (a[2]),
+                                      _mm256_mul_pd (z2, _mm256_set1_pd (a[3])))));
+  __m256d bb = _mm256_add_pd (
+    _mm256_add_pd (_mm256_set1_pd (b[0]),
+                   _mm256_mul_pd (z2, _mm256_set1_pd (b[1]))),
+    _mm256_mul_pd (z4, _mm256_add_pd (_mm256_set1_pd (b[2]),
+                                      _mm256_mul_pd (z2, _mm256_set1_pd (b[3])))));
+  __m128i m31 = _mm_set1_epi32 (31);
+  __m256d s0 = _mm256_i32gather_pd (tb, _mm_and_si128 (ia, m31), 8);
+  __m256d c0 = _mm256_i32gather_pd (tb, _mm_and_si128 (
+    _mm_add_epi32 (ia, _mm_set1_epi32 (8)), m31), 8);
+  __m256d r = _mm256_sub_pd (
+    _mm256_add_pd (s0, _mm256_mul_pd (aa, _mm256_mul_pd (z, c0))),
+    _mm256_mul_pd (bb, _mm256_mul_pd (z2, s0)));
+  _mm_storeu_ps (y, _mm256_cvtpd_ps (r));
+  return _mm_movemask_ps (_mm_castsi128_ps (in));
+}
+
+/* Arguments left by cr_sinf_n() to cr_sinf(): y[k[i]] = cr_sinf(x[i]) for
+   0 <= i < n.  The arguments are copied since x and y may be equal. */
+typedef struct {
+  size_t k[SINF_N_QUEUE];
+  float x[SINF_N_QUEUE];
+  int n;
+} sinf_queue_t;
+
+static void __attribute__((noinline))
+sinf_queue_flush (sinf_queue_t *q, float *y)
+{
+  for (int i = 0; i < q->n; i++)
+    y[q->k[i]] = cr_sinf (q->x[i]);
+  q->n = 0;
+}
+
+/* Evaluate sinf on x[k] to x[k+SINF_N_LANES-1], four at a time.  The lanes
+   not handled by sinf_fast_avx2() (tiny, huge, infinite or NaN arguments,
+   and the database ones) are appended to q, so that a single argument
+   reduced by rbig() does not stall the vector loop. */
+static inline void
+sinf_n_block (const float *x, float *y, size_t k, sinf_queue_t *q)
+{
+  // both halves are loaded before y is written, in case x == y
+  __m128 x0 = _mm_loadu_ps (x + k), x1 = _mm_loadu_ps (x + k + 4);
+  unsigned bad = ~(sinf_fast_avx2 (y + k, x0)
+                   | sinf_fast_avx2 (y + k + 4, x1) << 4)
+    & ((1u << SINF_N_LANES) - 1);
+  if (__builtin_expect (bad != 0, 0))
+  {
+    float xs[SINF_N_LANES];
+    _mm_storeu_ps (xs, x0);
+    _mm_storeu_ps (xs + 4, x1);
+    do {
+      int j = __builtin_ctz (bad);
+      bad &= bad - 1;
+      if (q->n == SINF_N_QUEUE)
+        sinf_queue_flush (q, y);
+      q->k[q->n] = k + j;
+      q->x[q->n++] = xs[j];
+    } while (bad);
+  }
+}
+#endif
+
+/* Sets y[k] = cr_sinf(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_sinf_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  sinf_queue_t q;
+  q.n = 0;
+  for (; k + SINF_N_LANES <= n; k += SINF_N_LANES)
+    sinf_n_block (x, y, k, &q);
+  sinf_queue_flush (&q, y);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_sinf (x[k]);
+}
@@ -24,10 +24,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <errno.h>
 #include <fenv.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -37,36 +42,37 @@ SOFTWARE.
 
 typedef union {float f; uint32_t u;} b32u32_u;
 
-float cr_sinpif(float x){
-  static const double sn[] = { 0x1.921fb54442d0fp-37, -0x1.4abbce6102b94p-112,  0x1.4669fa3c58463p-189};
-  static const double cn[] = {-0x1.3bd3cc9be45cfp-74, 0x1.03c1f08088742p-150, -0x1.55d1e5eff55a5p-228};
-  static const double S[] =
-    {0x0p+0, 0x1.91f65f10dd814p-5, 0x1.917a6bc29b42cp-4, 0x1.2c8106e8e613ap-3, 0x1.8f8b83c69a60bp-3, 0x1.f19f97b215f1bp-3,
-    0x1.294062ed59f06p-2, 0x1.58f9a75ab1fddp-2, 0x1.87de2a6aea963p-2, 0x1.b5d1009e15ccp-2, 0x1.e2b5d3806f63bp-2,
-    0x1.073879922ffeep-1, 0x1.1c73b39ae68c8p-1, 0x1.30ff7fce17035p-1, 0x1.44cf325091dd6p-1, 0x1.57d69348cecap-1,
-    0x1.6a09e667f3bcdp-1, 0x1.7b5df226aafafp-1, 0x1.8bc806b151741p-1, 0x1.9b3e047f38741p-1, 0x1.a9b66290ea1a3p-1,
-    0x1.b728345196e3ep-1, 0x1.c38b2f180bdb1p-1, 0x1.ced7af43cc773p-1, 0x1.d906bcf328d46p-1, 0x1.e212104f686e5p-1,
-    0x1.e9f4156c62ddap-1, 0x1.f0a7efb9230d7p-1, 0x1.f6297cff75cbp-1, 0x1.fa7557f08a517p-1, 0x1.fd88da3d12526p-1,
-    0x1.ff621e3796d7ep-1,0x1p+0, 0x1.ff621e3796d7ep-1, 0x1.fd88da3d12526p-1, 0x1.fa7557f08a517p-1, 0x1.f6297cff75cbp-1,
-    0x1.f0a7efb9230d7p-1, 0x1.e9f4156c62ddap-1, 0x1.e212104f686e5p-1, 0x1.d906bcf328d46p-1, 0x1.ced7af43cc773p-1,
-    0x1.c38b2f180bdb1p-1, 0x1.b728345196e3ep-1, 0x1.a9b66290ea1a3p-1, 0x1.9b3e047f38741p-1, 0x1.8bc806b151741p-1,
-    0x1.7b5df226aafafp-1, 0x1.6a09e667f3bcdp-1, 0x1.57d69348cecap-1, 0x1.44cf325091dd6p-1, 0x1.30ff7fce17035p-1,
-    0x1.1c73b39ae68c8p-1, 0x1.073879922ffeep-1, 0x1.e2b5d3806f63bp-2, 0x1.b5d1009e15ccp-2, 0x1.87de2a6aea963p-2,
-    0x1.58f9a75ab1fddp-2, 0x1.294062ed59f06p-2, 0x1.f19f97b215f1bp-3, 0x1.8f8b83c69a60bp-3, 0x1.2c8106e8e613ap-3,
-    0x1.917a6bc29b42cp-4, 0x1.91f65f10dd814p-5,0x0p+0, -0x1.91f65f10dd814p-5, -0x1.917a6bc29b42cp-4, -0x1.2c8106e8e613ap-3,
-    -0x1.8f8b83c69a60bp-3, -0x1.f19f97b215f1bp-3, -0x1.294062ed59f06p-2, -0x1.58f9a75ab1fddp-2, -0x1.87de2a6aea963p-2,
-    -0x1.b5d1009e15ccp-2, -0x1.e2b5d3806f63bp-2, -0x1.073879922ffeep-1, -0x1.1c73b39ae68c8p-1, -0x1.30ff7fce17035p-1,
-    -0x1.44cf325091dd6p-1, -0x1.57d69348cecap-1, -0x1.6a09e667f3bcdp-1, -0x1.7b5df226aafafp-1, -0x1.8bc806b151741p-1,
-    -0x1.9b3e047f38741p-1, -0x1.a9b66290ea1a3p-1, -0x1.b728345196e3ep-1, -0x1.c38b2f180bdb1p-1, -0x1.ced7af43cc773p-1,
-    -0x1.d906bcf328d46p-1, -0x1.e212104f686e5p-1, -0x1.e9f4156c62ddap-1, -0x1.f0a7efb9230d7p-1, -0x1.f6297cff75cbp-1,
-    -0x1.fa7557f08a517p-1, -0x1.fd88da3d12526p-1, -0x1.ff621e3796d7ep-1,-0x1p+0, -0x1.ff621e3796d7ep-1,
-    -0x1.fd88da3d12526p-1, -0x1.fa7557f08a517p-1, -0x1.f6297cff75cbp-1, -0x1.f0a7efb9230d7p-1, -0x1.e9f4156c62ddap-1,
-    -0x1.e212104f686e5p-1, -0x1.d906bcf328d46p-1, -0x1.ced7af43cc773p-1, -0x1.c38b2f180bdb1p-1, -0x1.b728345196e3ep-1,
-    -0x1.a9b66290ea1a3p-1, -0x1.9b3e047f38741p-1, -0x1.8bc806b151741p-1, -0x1.7b5df226aafafp-1, -0x1.6a09e667f3bcdp-1,
-    -0x1.57d69348cecap-1, -0x1.44cf325091dd6p-1, -0x1.30ff7fce17035p-1, -0x1.1c73b39ae68c8p-1, -0x1.073879922ffeep-1,
-    -0x1.e2b5d3806f63bp-2, -0x1.b5d1009e15ccp-2, -0x1.87de2a6aea963p-2, -0x1.58f9a75ab1fddp-2, -0x1.294062ed59f06p-2,
-    -0x1.f19f97b215f1bp-3, -0x1.8f8b83c69a60bp-3, -0x1.2c8106e8e613ap-3, -0x1.917a6bc29b42cp-4, -0x1.91f65f10dd814p-5};
+// shared by cr_sinpif() and cr_sinpif_n()
+static const double sn[] = { 0x1.921fb54442d0fp-37, -0x1.4abbce6102b94p-112,  0x1.4669fa3c58463p-189};
+static const double cn[] = {-0x1.3bd3cc9be45cfp-74, 0x1.03c1f08088742p-150, -0x1.55d1e5eff55a5p-228};
+static const double S[] =
+  {0x0p+0, 0x1.91f65f10dd814p-5, 0x1.917a6bc29b42cp-4, 0x1.2c8106e8e613ap-3, 0x1.8f8b83c69a60bp-3, 0x1.f19f97b215f1bp-3,
+  0x1.294062ed59f06p-2, 0x1.58f9a75ab1fddp-2, 0x1.87de2a6aea963p-2, 0x1.b5d1009e15ccp-2, 0x1.e2b5d3806f63bp-2,
+  0x1.073879922ffeep-1, 0x1.1c73b39ae68c8p-1, 0x1.30ff7fce17035p-1, 0x1.44cf325091dd6p-1, 0x1.57d69348cecap-1,
+  0x1.6a09e667f3bcdp-1, 0x1.7b5df226aafafp-1, 0x1.8bc806b151741p-1, 0x1.9b3e047f38741p-1, 0x1.a9b66290ea1a3p-1,
+  0x1.b728345196e3ep-1, 0x1.c38b2f180bdb1p-1, 0x1.ced7af43cc773p-1, 0x1.d906bcf328d46p-1, 0x1.e212104f686e5p-1,
+  0x1.e9f4156c62ddap-1, 0x1.f0a7efb9230d7p-1, 0x1.f6297cff75cbp-1, 0x1.fa7557f08a517p-1, 0x1.fd88da3d12526p-1,
+  0x1.ff621e3796d7ep-1,0x1p+0, 0x1.ff621e3796d7ep-1, 0x1.fd88da3d12526p-1, 0x1.fa7557f08a517p-1, 0x1.f6297cff75cbp-1,
+  0x1.f0a7efb9230d7p-1, 0x1.e9f4156c62ddap-1, 0x1.e212104f686e5p-1, 0x1.d906bcf328d46p-1, 0x1.ced7af43cc773p-1,
+  0x1.c38b2f180bdb1p-1, 0x1.b728345196e3ep-1, 0x1.a9b66290ea1a3p-1, 0x1.9b3e047f38741p-1, 0x1.8bc806b151741p-1,
+  0x1.7b5df226aafafp-1, 0x1.6a09e667f3bcdp-1, 0x1.57d69348cecap-1, 0x1.44cf325091dd6p-1, 0x1.30ff7fce17035p-1,
+  0x1.1c73b39ae68c8p-1, 0x1.073879922ffeep-1, 0x1.e2b5d3806f63bp-2, 0x1.b5d1009e15ccp-2, 0x1.87de2a6aea963p-2,
+  0x1.58f9a75ab1fddp-2, 0x1.294062ed59f06p-2, 0x1.f19f97b215f1bp-3, 0x1.8f8b83c69a60bp-3, 0x1.2c8106e8e613ap-3,
+  0x1.917a6bc29b42cp-4, 0x1.91f65f10dd814p-5,0x0p+0, -0x1.91f65f10dd814p-5, -0x1.917a6bc29b42cp-4, -0x1.2c8106e8e613ap-3,
+  -0x1.8f8b83c69a60bp-3, -0x1.f19f97b215f1bp-3, -0x1.294062ed59f06p-2, -0x1.58f9a75ab1fddp-2, -0x1.87de2a6aea963p-2,
+  -0x1.b5d1009e15ccp-2, -0x1.e2b5d3806f63bp-2, -0x1.073879922ffeep-1, -0x1.1c73b39ae68c8p-1, -0x1.30ff7fce17035p-1,
+  -0x1.44cf325091dd6p-1, -0x1.57d69348cecap-1, -0x1.6a09e667f3bcdp-1, -0x1.7b5df226aafafp-1, -0x1.8bc806b151741p-1,
+  -0x1.9b3e047f38741p-1, -0x1.a9b66290ea1a3p-1, -0x1.b728345196e3ep-1, -0x1.c38b2f180bdb1p-1, -0x1.ced7af43cc773p-1,
+  -0x1.d906bcf328d46p-1, -0x1.e212104f686e5p-1, -0x1.e9f4156c62ddap-1, -0x1.f0a7efb9230d7p-1, -0x1.f6297cff75cbp-1,
+  -0x1.fa7557f08a517p-1, -0x1.fd88da3d12526p-1, -0x1.ff621e3796d7ep-1,-0x1p+0, -0x1.ff621e3796d7ep-1,
+  -0x1.fd88da3d12526p-1, -0x1.fa7557f08a517p-1, -0x1.f6297cff75cbp-1, -0x1.f0a7efb9230d7p-1, -0x1.e9f4156c62ddap-1,
+  -0x1.e212104f686e5p-1, -0x1.d906bcf328d46p-1, -0x1.ced7af43cc773p-1, -0x1.c38b2f180bdb1p-1, -0x1.b728345196e3ep-1,
+  -0x1.a9b66290ea1a3p-1, -0x1.9b3e047f38741p-1, -0x1.8bc806b151741p-1, -0x1.7b5df226aafafp-1, -0x1.6a09e667f3bcdp-1,
+  -0x1.57d69348cecap-1, -0x1.44cf325091dd6p-1, -0x1.30ff7fce17035p-1, -0x1.1c73b39ae68c8p-1, -0x1.073879922ffeep-1,
+  -0x1.e2b5d3806f63bp-2, -0x1.b5d1009e15ccp-2, -0x1.87de2a6aea963p-2, -0x1.58f9a75ab1fddp-2, -0x1.294062ed59f06p-2,
+  -0x1.f19f97b215f1bp-3, -0x1.8f8b83c69a60bp-3, -0x1.2c8106e8e613ap-3, -0x1.917a6bc29b42cp-4, -0x1.91f65f10dd814p-5};
 
+float cr_sinpif(float x){
   b32u32_u ix = {.f = x};
   int32_t e = (ix.u>>23)&0xff;
   if(__builtin_expect(e == 0xff, 0)){
@@ -110,3 +116,118 @@ float sinpif(float x){
   return cr_sinpif(x);
 }
 #endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_sinpif_n(). */
+#define SINPIF_N_LANES 8
+/* Number of arguments cr_sinpif_n() may leave to cr_sinpif() before it
+   evaluates them. */
+#define SINPIF_N_QUEUE 64
+
+/* Same as cr_sinpif() for 113 <= e <= 143 on the 4 lanes of x: the
+   reduction is done on the integer significand with variable shifts, and
+   the S[] lookups are gathers.  The operations are those of cr_sinpif(), in
+   the same order, thus each lane of y is bit-identical to cr_sinpif(x).
+   Return the mask of the lanes in that range, except the arguments for which
+   sinpi(x) is an exact zero. */
+static inline unsigned
+sinpif_fast_avx2 (float *y, __m128 x)
+{
+  __m128i ux = _mm_castps_si128 (x);
+  // 0 <= s <= 30 with s = 143 - e
+  __m128i e = _mm_and_si128 (_mm_srli_epi32 (ux, 23), _mm_set1_epi32 (0xff));
+  __m128i s = _mm_sub_epi32 (_mm_set1_epi32 (143), e);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (s, _mm_set1_epi32 (30)), s);
+  __m128i m = _mm_or_si128 (_mm_and_si128 (ux, _mm_set1_epi32 (~0u >> 9)),
+                            _mm_set1_epi32 (1 << 23));
+  __m128i sgn = _mm_srai_epi32 (ux, 31);
+  m = _mm_sub_epi32 (_mm_xor_si128 (m, sgn), sgn);
+  // exact zeros: si >= 0 && (m<<si) == 0 with si = 25 - s
+  __m128i si = _mm_sub_epi32 (_mm_set1_epi32 (25), s);
+  __m128i zero = _mm_andnot_si128 (
+    _mm_cmpgt_epi32 (_mm_setzero_si128 (), si),
+    _mm_cmpeq_epi32 (_mm_sllv_epi32 (m, si), _mm_setzero_si128 ()));
+  in = _mm_andnot_si128 (zero, in);
+
+  /* The other lanes only go through integer operations and bounded
+     conversions, thus they raise no exception. */
+  __m128i k = _mm_sllv_epi32 (m, _mm_sub_epi32 (_mm_set1_epi32 (31), s));
+  __m256d z = _mm256_cvtepi32_pd (k), z2 = _mm256_mul_pd (z, z);
+  __m256d fs = _mm256_add_pd (_mm256_set1_pd (sn[0]), _mm256_mul_pd (z2,
+    _mm256_add_pd (_mm256_set1_pd (sn[1]),
+                   _mm256_mul_pd (z2, _mm256_set1_pd (sn[2])))));
+  __m256d fc = _mm256_add_pd (_mm256_set1_pd (cn[0]), _mm256_mul_pd (z2,
+    _mm256_add_pd (_mm256_set1_pd (cn[1]),
+                   _mm256_mul_pd (z2, _mm256_set1_pd (cn[2])))));
+  __m128i iq = _mm_srav_epi32 (m, s);
+  iq = _mm_srli_epi32 (_mm_add_epi32 (iq, _mm_set1_epi32 (1)), 1);
+  __m128i m127 = _mm_set1_epi32 (127);
+  __m256d ts = _mm256_i32gather_pd (S, _mm_and_si128 (iq, m127), 8);
+  __m256d tc = _mm256_i32gather_pd (S, _mm_and_si128 (
+    _mm_add_epi32 (iq, _mm_set1_epi32 (32)), m127), 8);
+  __m256d r = _mm256_add_pd (
+    _mm256_add_pd (ts, _mm256_mul_pd (_mm256_mul_pd (ts, z2), fc)),
+    _mm256_mul_pd (_mm256_mul_pd (tc, z), fs));
+  _mm_storeu_ps (y, _mm256_cvtpd_ps (r));
+  return _mm_movemask_ps (_mm_castsi128_ps (in));
+}
+
+/* Arguments left by cr_sinpif_n() to cr_sinpif(): y[k[i]] = cr_sinpif(x[i]) for
+   0 <= i < n.  The arguments are copied since x and y may be equal. */
+typedef struct {
+  size_t k[SINPIF_N_QUEUE];
+  float x[SINPIF_N_QUEUE];
+  int n;
+} sinpif_queue_t;
+
+static void __attribute__((noinline))
+sinpif_queue_flush (sinpif_queue_t *q, float *y)
+{
+  for (int i = 0; i < q->n; i++)
+    y[q->k[i]] = cr_sinpif (q->x[i]);
+  q->n = 0;
+}
+
+/* Evaluate sinpif on x[k] to x[k+SINPIF_N_LANES-1], four at a time.
+   The lanes not handled by sinpif_fast_avx2() (tiny, huge, infinite or
+   NaN arguments, and exact zeros) are appended to q. */
+static inline void
+sinpif_n_block (const float *x, float *y, size_t k, sinpif_queue_t *q)
+{
+  // both halves are loaded before y is written, in case x == y
+  __m128 x0 = _mm_loadu_ps (x + k), x1 = _mm_loadu_ps (x + k + 4);
+  unsigned bad = ~(sinpif_fast_avx2 (y + k, x0)
+                   | sinpif_fast_avx2 (y + k + 4, x1) << 4)
+    & ((1u << SINPIF_N_LANES) - 1);
+  if (__builtin_expect (bad != 0, 0))
+  {
+    float xs[SINPIF_N_LANES];
+    _mm_storeu_ps (xs, x0);
+    _mm_storeu_ps (xs + 4, x1);
+    do {
+      int j = __builtin_ctz (bad);
+      bad &= bad - 1;
+      if (q->n == SINPIF_N_QUEUE)
+        sinpif_queue_flush (q, y);
+      q->k[q->n] = k + j;
+      q->x[q->n++] = xs[j];
+    } while (bad);
+  }
+}
+#endif
+
+/* Sets y[k] = cr_sinpif(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_sinpif_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  sinpif_queue_t q;
+  q.n = 0;
+  for (; k + SINPIF_N_LANES <= n; k += SINPIF_N_LANES)
+    sinpif_n_block (x, y, k, &q);
+  sinpif_queue_flush (&q, y);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_sinpif (x[k]);
+}
@@ -30,26 +30,139 @@ SOFTWARE.
 #include <stdint.h>
 #include <string.h>
 #include <fenv.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #ifndef NO_OPENMP
 #include <omp.h>
 #endif
 
+#include "../../generic/support/check_loop.h"
+
+#define STR(x) #x
+#define XSTR(x) STR(x)
+
+int check_range (uint32_t nmin, uint32_t nmax, void (*check) (uint32_t));
+
 #include "function_under_test.h"
 
 float cr_function_under_test (float);
 float ref_function_under_test (float);
+#ifdef CORE_MATH_DIFF
+float old_function_under_test (float);
+#endif
 int ref_fesetround (int);
 void ref_init (void);
 
+/* the batch variant of the function, if any (not in the GNU libc) */
+#if defined(cr_function_under_test_n) && !defined(CORE_MATH_CHECK_STD)
+#define CHECK_BATCH
+void cr_function_under_test_n (const float *, float *, size_t);
+#endif
+
 /* the code below is to check correctness by exhaustive search */
 
 int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
 
 int rnd = 0;
 int keep = 0;
+static int batch = 0;
 
 typedef union { uint32_t n; float x; } union_t;
 
+/* Golden reference cache (--golden FILE).  FILE holds the encodings of the
+   reference values for one function and one rounding mode, indexed by the
+   encoding of the input: a header page followed by 2^32 words (16 GiB, only
+   the pages of the inputs visited by doloop() are actually allocated).  If
+   FILE does not exist, or was left incomplete, the reference values are
+   computed with MPFR as usual and stored; once the loop has completed over
+   all the inputs (not only a shard, see below), the file is marked complete
+   and the next runs read the reference values from it instead of calling
+   MPFR.  Delete FILE when the reference code (the *_mpfr.c file) changes. */
+
+#define GOLDEN_MAGIC "CORE-MATH golden"
+#define GOLDEN_HEADER 4096
+#define GOLDEN_SIZE ((off_t) GOLDEN_HEADER + ((off_t) 4 << 32))
+
+typedef struct {
+  char magic[16];
+  char function[48];
+  int32_t rnd;
+  uint32_t complete;
+} golden_header_t;
+
+static golden_header_t *golden_header = NULL;
+static uint32_t *golden = NULL;
+static int golden_ready = 0; // golden[] holds the reference values
+static int golden_partial = 0; // some inputs were skipped (--shard, resume)
+static _Thread_local int rnd_set = 0; // this thread has called fesetround
+
+static void
+golden_open (const char *file)
+{
+  struct stat st;
+  int exists = stat (file, &st) == 0;
+
+  if (sizeof (void *) < 8)
+  {
+    fprintf (stderr, "Error, --golden requires a 64-bit address space\n");
+    exit (1);
+  }
+  int fd = open (file, O_RDWR | O_CREAT, 0644);
+  if (fd < 0 || (exists && st.st_size != GOLDEN_SIZE && st.st_size != 0)
+      || ftruncate (fd, GOLDEN_SIZE) != 0)
+  {
+    fprintf (stderr, "Error, cannot use %s as golden file\n", file);
+    exit (1);
+  }
+  char *p = mmap (NULL, GOLDEN_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close (fd);
+  if (p == MAP_FAILED)
+  {
+    perror ("mmap");
+    exit (1);
+  }
+  golden_header = (golden_header_t *) p;
+  golden = (uint32_t *) (p + GOLDEN_HEADER);
+
+  const char *function = XSTR(cr_function_under_test);
+  if (golden_header->magic[0] != 0
+      && (memcmp (golden_header->magic, GOLDEN_MAGIC, 16) != 0
+          || strcmp (golden_header->function, function) != 0
+          || golden_header->rnd != rnd))
+  {
+    fprintf (stderr, "Error, %s is not a golden file for %s in this rounding"
+             " mode\n", file, function);
+    exit (1);
+  }
+  golden_ready = golden_header->complete;
+  if (!golden_ready)
+  {
+    memcpy (golden_header->magic, GOLDEN_MAGIC, 16);
+    snprintf (golden_header->function, sizeof (golden_header->function),
+              "%s", function);
+    golden_header->rnd = rnd;
+  }
+#ifdef MADV_SEQUENTIAL
+  /* each thread reads its part of the inputs in increasing order */
+  if (golden_ready)
+    madvise (p, GOLDEN_SIZE, MADV_SEQUENTIAL);
+#endif
+}
+
+static void
+golden_close (void)
+{
+  if (!golden_ready && !golden_partial)
+  {
+    /* the data must reach the file before it is marked complete */
+    msync (golden_header, GOLDEN_SIZE, MS_SYNC);
+    golden_header->complete = 1;
+  }
+  munmap (golden_header, GOLDEN_SIZE);
+}
+
 float
 asfloat (uint32_t n)
 {
@@ -69,15 +182,485 @@ asuint (float f)
   return u.i;
 }
 
+/* Without MPFR calls in between, the rounding mode of each thread only needs
+   to be set once (fesetround would dominate the loop). */
+static inline void
+set_rounding_once (void)
+{
+  if (!rnd_set)
+  {
+    fesetround (rnd1[rnd]);
+    rnd_set = 1;
+  }
+}
+
+/* Sharding and checkpoints.  doloop() calls check_range (nmin, nmax, check)
+   which calls check (n) for nmin <= n <= nmax, by blocks of CHECK_BLOCK
+   consecutive inputs, each block being checked by one thread.  With
+   --shard k/N, only the blocks b (counted from 0) with b mod N = k-1 are
+   checked: the shards are interleaved, so that each one gets the same mix of
+   easy and hard inputs, and N processes (on one or several machines) can
+   share the work.  With --checkpoint FILE, the ranges of the completed
+   blocks and the failures (with --keep) are written to FILE every
+   CHECKPOINT_INTERVAL seconds and at the end; a run started again with the
+   same FILE (and the same options) reads it and skips the completed blocks,
+   thus a killed run resumes where it stopped. */
+
+#define CHECK_BLOCK 0x10000
+#define CHECKPOINT_INTERVAL 60
+
+static int shard_k = 1, shard_n = 1;
+static const char *checkpoint_file = NULL;
+static uint32_t range_min, range_max;
+static uint64_t nblocks;
+static unsigned char *block_done = NULL; // one byte per block
+/* the inputs where the check failed, with the block being checked (the
+   failing input may be -x for x in the block), or nblocks for the failures
+   read from the checkpoint */
+typedef struct {
+  uint32_t x;
+  uint64_t block;
+} failure_t;
+static failure_t *fails = NULL;
+static _Thread_local uint64_t current_block;
+static uint64_t nfails = 0, fails_size = 0;
+static double checkpoint_next;
+
+static void
+record_failure (uint32_t n)
+{
+#pragma omp critical (checkpoint)
+  {
+    if (nfails == fails_size)
+    {
+      fails_size = fails_size ? 2 * fails_size : 1024;
+      fails = realloc (fails, fails_size * sizeof (failure_t));
+      if (fails == NULL)
+      {
+        fprintf (stderr, "Error, cannot allocate the list of failures\n");
+        exit (1);
+      }
+    }
+    fails[nfails].x = n;
+    fails[nfails++].block = current_block;
+  }
+}
+
+static void
+checkpoint_write (void)
+{
+  char tmp[4096];
+  snprintf (tmp, sizeof (tmp), "%s.tmp", checkpoint_file);
+  FILE *fp = fopen (tmp, "w");
+  if (fp == NULL)
+  {
+    fprintf (stderr, "Error, cannot write %s\n", tmp);
+    exit (1);
+  }
+  fprintf (fp, "function %s\n", XSTR(cr_function_under_test));
+  fprintf (fp, "rnd %d\n", rnd);
+  fprintf (fp, "range 0x%08x 0x%08x\n", range_min, range_max);
+  fprintf (fp, "shard %d/%d\n", shard_k, shard_n);
+  // the completed blocks, merged into ranges of inputs
+  for (uint64_t b = 0; b < nblocks; )
+  {
+    unsigned char d;
+#pragma omp atomic read
+    d = block_done[b];
+    if (!d)
+    {
+      b++;
+      continue;
+    }
+    uint64_t c = b + 1;
+    for (; c < nblocks; c++)
+    {
+#pragma omp atomic read
+      d = block_done[c];
+      if (!d)
+        break;
+    }
+    uint64_t last = (uint64_t) range_min + c * CHECK_BLOCK - 1;
+    fprintf (fp, "done 0x%08llx 0x%08llx\n",
+             (unsigned long long) range_min + b * CHECK_BLOCK,
+             (unsigned long long) (last < range_max ? last : range_max));
+    b = c;
+  }
+  // the failures in the blocks not completed yet will be found again
+  for (uint64_t i = 0; i < nfails; i++)
+  {
+    unsigned char d = 1;
+    if (fails[i].block < nblocks)
+    {
+#pragma omp atomic read
+      d = block_done[fails[i].block];
+    }
+    if (d)
+      fprintf (fp, "fail 0x%08x\n", fails[i].x);
+  }
+  /* the rename makes the update atomic: if the process is killed while
+     writing, the previous checkpoint remains */
+  if (fclose (fp) != 0 || rename (tmp, checkpoint_file) != 0)
+  {
+    fprintf (stderr, "Error, cannot write %s\n", checkpoint_file);
+    exit (1);
+  }
+}
+
+/* Differential check (CORE_MATH_DIFF_REV in check.sh): the function under
+   test is only compared with the reference where it disagrees with the
+   version of another revision, or where that version failed.  The failures
+   of the other version are read with --known-failures FILE from the
+   checkpoints of a run of the same check on it (see CORE_MATH_DIFF_FAILURES
+   in check.sh, several shards may be concatenated); unless FILE shows that
+   this run covered all the blocks checked here, all the inputs are compared
+   with the reference. */
+static const char *known_file = NULL;
+static unsigned char *known_done = NULL; // the blocks of the other run
+static uint32_t *known_fails = NULL;
+static uint64_t nknown = 0, known_size = 0;
+
+static void
+add_known_failure (uint32_t n)
+{
+  if (nknown == known_size)
+  {
+    known_size = known_size ? 2 * known_size : 1024;
+    known_fails = realloc (known_fails, known_size * sizeof (uint32_t));
+    if (known_fails == NULL)
+    {
+      fprintf (stderr, "Error, cannot allocate the list of known failures\n");
+      exit (1);
+    }
+  }
+  known_fails[nknown++] = n;
+}
+
+#ifdef CORE_MATH_DIFF
+static int known_complete = 0;
+static unsigned long diffs = 0;
+
+static int
+cmp_uint32 (const void *a, const void *b)
+{
+  uint32_t u = *(const uint32_t *) a, v = *(const uint32_t *) b;
+  return (u > v) - (u < v);
+}
+
+static inline int
+is_known_failure (uint32_t n)
+{
+  return nknown && bsearch (&n, known_fails, nknown, sizeof (uint32_t),
+                            cmp_uint32) != NULL;
+}
+#endif
+
+/* Read FILE, written by checkpoint_write().  Without known, FILE is the
+   checkpoint of this run: the blocks done are skipped and the failures are
+   reported again.  With known, FILE holds the checkpoints of the other
+   revision (--known-failures): the blocks done are marked in known_done and
+   the failures are added to known_fails. */
+static void
+checkpoint_parse (const char *file, int known)
+{
+  FILE *fp = fopen (file, "r");
+  if (fp == NULL) // first run, or no checkpoint of the other revision
+    return;
+  unsigned char *done = known ? known_done : block_done;
+  char line[256], function[64];
+  int r, k, n;
+  unsigned int a, b;
+  while (fgets (line, sizeof (line), fp) != NULL)
+  {
+    if (sscanf (line, "function %63s", function) == 1)
+    {
+      if (strcmp (function, XSTR(cr_function_under_test)) != 0)
+        goto mismatch;
+    }
+    else if (sscanf (line, "rnd %d", &r) == 1)
+    {
+      if (r != rnd)
+        goto mismatch;
+    }
+    else if (sscanf (line, "range %x %x", &a, &b) == 2)
+    {
+      if (a != range_min || b != range_max)
+        goto mismatch;
+    }
+    else if (sscanf (line, "shard %d/%d", &k, &n) == 2)
+    {
+      if (!known && (k != shard_k || n != shard_n))
+        goto mismatch;
+    }
+    else if (sscanf (line, "done %x %x", &a, &b) == 2)
+    {
+      if (a < range_min || b > range_max || a > b)
+        goto mismatch;
+      // only the blocks entirely within [a,b] are done
+      for (uint64_t i = ((uint64_t) a - range_min) / CHECK_BLOCK;
+           i < nblocks; i++)
+      {
+        uint64_t first = (uint64_t) range_min + i * CHECK_BLOCK;
+        uint64_t last = first + CHECK_BLOCK - 1;
+        if (last > range_max)
+          last = range_max;
+        if (last > b)
+          break;
+        if (first >= a)
+          done[i] = 1;
+      }
+    }
+    else if (sscanf (line, "fail %x", &a) == 1 && known)
+      add_known_failure (a);
+    else if (sscanf (line, "fail %x", &a) == 1)
+    {
+      printf ("FAIL x=%a (from %s)\n", asfloat (a), file);
+      current_block = nblocks;
+      record_failure (a);
+    }
+    else
+      goto mismatch;
+  }
+  fclose (fp);
+  return;
+ mismatch:
+  fprintf (stderr, "Error, %s is not a checkpoint of this check (function,"
+           " rounding mode or shard differ)\n", file);
+  exit (1);
+}
+
+#ifdef CORE_MATH_DIFF
+static void
+known_failures_read (void)
+{
+  known_done = calloc (nblocks, 1);
+  if (known_done == NULL)
+  {
+    fprintf (stderr, "Error, cannot allocate the list of blocks\n");
+    exit (1);
+  }
+  if (known_file != NULL)
+    checkpoint_parse (known_file, 1);
+  known_complete = 1;
+  for (uint64_t b = shard_k - 1; b < nblocks; b += shard_n)
+    known_complete &= known_done[b];
+  free (known_done);
+  qsort (known_fails, nknown, sizeof (uint32_t), cmp_uint32);
+  if (known_complete)
+    printf ("Differential check, %llu known failure(s) of the other"
+            " version\n", (unsigned long long) nknown);
+  else
+    printf ("No complete run of the other version (--known-failures),"
+            " checking all the inputs\n");
+}
+#endif
+
+static void
+checkpoint_poll (void)
+{
+  double now = check_loop_now (), next;
+#pragma omp atomic read
+  next = checkpoint_next;
+  if (now < next)
+    return;
+#pragma omp critical (checkpoint)
+  if (now >= checkpoint_next)
+  {
+#pragma omp atomic write
+    checkpoint_next = now + CHECKPOINT_INTERVAL;
+    checkpoint_write ();
+  }
+}
+
+#ifdef CHECK_BATCH
+/* Batch check (--batch): the batch variant cr_f_n of the function, which
+   sets y[i] = cr_f (x[i]) for 0 <= i < n, is compared with cr_f on all the
+   2^32 inputs, whatever the range checked by doloop(), since the lanes of
+   special inputs (zero, negative, infinite or NaN) must also agree.
+   check_range() goes over 0 <= n < 2^30, with the inputs n, n ^ 0x40000000
+   and their opposites: flipping the most significant bit of the exponent
+   pairs each moderate input with a huge, infinite or NaN one, thus the lanes
+   of a vector take different paths.  At the end of each block, the
+   4*CHECK_BLOCK inputs are given to cr_f_n (a) in one call, where many lanes
+   are set aside for the scalar path (more than the queue of cr_sinf_n for
+   example) and some remain pending at the end of the array, (b) in place
+   (x == y) by consecutive calls on 1, 2, ..., BATCH_MAX_LEN, 1, ...
+   elements, which covers the short arrays and all the tails, and (c) the
+   same out of place.  The results must have the same encodings as those of
+   cr_f. */
+
+#define BATCH_SIZE (4 * CHECK_BLOCK)
+#define BATCH_MAX_LEN 80
+#define BATCH_CALLS 3
+
+static _Thread_local float *batch_x = NULL, *batch_z, *batch_y[BATCH_CALLS];
+static _Thread_local size_t batch_len = 0;
+
+static void
+batch_add (uint32_t n)
+{
+  if (batch_x == NULL)
+  {
+    batch_x = malloc ((2 + BATCH_CALLS) * BATCH_SIZE * sizeof (float));
+    if (batch_x == NULL)
+    {
+      fprintf (stderr, "Error, cannot allocate the batch buffers\n");
+      exit (1);
+    }
+    batch_z = batch_x + BATCH_SIZE;
+    for (int k = 0; k < BATCH_CALLS; k++)
+      batch_y[k] = batch_z + (k + 1) * BATCH_SIZE;
+  }
+  batch_x[batch_len++] = asfloat (n);
+  batch_x[batch_len++] = asfloat (n ^ 0x40000000);
+  batch_x[batch_len++] = asfloat (n ^ 0x80000000);
+  batch_x[batch_len++] = asfloat (n ^ 0xc0000000);
+}
+
+static void
+batch_check (void)
+{
+  static const char *calls[BATCH_CALLS] = { "one call", "in place, by pieces",
+                                            "by pieces" };
+  float *x = batch_x, *z = batch_z, **y = batch_y;
+  size_t n = batch_len;
+
+  set_rounding_once ();
+  for (size_t i = 0; i < n; i++)
+    z[i] = cr_function_under_test (x[i]);
+  cr_function_under_test_n (x, y[0], n);
+  memcpy (y[1], x, n * sizeof (float));
+  for (size_t i = 0, len = 1; i < n; i += len, len = len % BATCH_MAX_LEN + 1)
+  {
+    size_t m = (n - i < len) ? n - i : len;
+    cr_function_under_test_n (y[1] + i, y[1] + i, m);
+    cr_function_under_test_n (x + i, y[2] + i, m);
+  }
+
+  for (size_t i = 0; i < n; i++)
+  {
+    int fail = 0;
+    for (int k = 0; k < BATCH_CALLS; k++)
+      if (asuint (y[k][i]) != asuint (z[i]))
+      {
+        printf ("FAIL x=%a %s=%a %s=%a (%s)\n", x[i],
+                XSTR(cr_function_under_test), z[i],
+                XSTR(cr_function_under_test_n), y[k][i], calls[k]);
+        fail = 1;
+      }
+    if (fail)
+    {
+      fflush (stdout);
+      if (!keep) exit (1);
+      record_failure (asuint (x[i]));
+    }
+  }
+  batch_len = 0;
+}
+#endif
+
+int
+check_range (uint32_t nmin, uint32_t nmax, void (*check) (uint32_t))
+{
+  range_min = nmin;
+  range_max = nmax;
+  nblocks = ((uint64_t) nmax - nmin) / CHECK_BLOCK + 1;
+  block_done = calloc (nblocks, 1);
+  uint32_t *todo = malloc (nblocks * sizeof (uint32_t));
+  if (block_done == NULL || todo == NULL)
+  {
+    fprintf (stderr, "Error, cannot allocate the list of blocks\n");
+    exit (1);
+  }
+  if (checkpoint_file != NULL)
+    checkpoint_parse (checkpoint_file, 0);
+#ifdef CORE_MATH_DIFF
+  if (!batch)
+    known_failures_read ();
+#endif
+
+  // the blocks of this shard which remain to be checked
+  uint64_t ntodo = 0, total = 0;
+  for (uint64_t b = shard_k - 1; b < nblocks; b += shard_n)
+    if (!block_done[b])
+    {
+      todo[ntodo++] = b;
+      uint64_t first = (uint64_t) nmin + b * CHECK_BLOCK;
+      total += (first + CHECK_BLOCK - 1 <= nmax) ? CHECK_BLOCK
+        : nmax - first + 1;
+    }
+  golden_partial = ntodo < nblocks;
+
+  checkpoint_next = check_loop_now () + CHECKPOINT_INTERVAL;
+  check_loop_begin (total, XSTR (cr_function_under_test));
+#pragma omp parallel for schedule(dynamic,1)
+  for (uint64_t i = 0; i < ntodo; i++)
+  {
+    uint64_t first = (uint64_t) nmin + (uint64_t) todo[i] * CHECK_BLOCK;
+    uint64_t last = first + CHECK_BLOCK - 1;
+    if (last > nmax)
+      last = nmax;
+    current_block = todo[i];
+    for (uint64_t n = first; n <= last; n++)
+    {
+      check_loop_step ();
+      check (n);
+    }
+#ifdef CHECK_BATCH
+    if (batch)
+      batch_check ();
+#endif
+#pragma omp atomic write
+    block_done[todo[i]] = 1;
+    if (checkpoint_file != NULL)
+      checkpoint_poll ();
+  }
+  check_loop_end ();
+  if (checkpoint_file != NULL)
+    checkpoint_write ();
+  free (todo);
+  free (block_done);
+
+  if (nfails == 0)
+  {
+    printf ("all ok\n");
+    return 0;
+  }
+  printf ("%llu failure(s)\n", (unsigned long long) nfails);
+  return 1;
+}
+
 void
 doit (uint32_t n)
 {
   float x, y, z;
   x = asfloat (n);
-  ref_init ();
-  ref_fesetround (rnd);
-  y = ref_function_under_test (x);
-  fesetround (rnd1[rnd]);
+#ifdef CORE_MATH_DIFF
+  if (known_complete)
+  {
+    set_rounding_once ();
+    z = cr_function_under_test (x);
+    if (asuint (z) == asuint (old_function_under_test (x))
+        && !is_known_failure (n))
+      return;
+#pragma omp atomic update
+    diffs ++;
+  }
+#endif
+  if (golden_ready)
+  {
+    y = asfloat (golden[n]);
+    set_rounding_once ();
+  }
+  else
+  {
+    ref_init ();
+    ref_fesetround (rnd);
+    y = ref_function_under_test (x);
+    if (golden != NULL)
+      golden[n] = asuint (y);
+    fesetround (rnd1[rnd]);
+  }
   z = cr_function_under_test (x);
   /* Note: the test y != z would not distinguish +0 and -0, instead we compare
      the 32-bit encodings. */
@@ -86,12 +669,15 @@ doit (uint32_t n)
     printf ("FAIL x=%a ref=%a y=%a\n", x, y, z);
     fflush (stdout);
     if (!keep) exit (1);
+    record_failure (n);
   }
 }
 
 int
 main (int argc, char *argv[])
 {
+  const char *golden_file = NULL;
+
   while (argc >= 2)
     {
       if (strcmp (argv[1], "--rndn") == 0)
@@ -124,6 +710,58 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--batch") == 0)
+        {
+#ifndef CHECK_BATCH
+          fprintf (stderr, "Error, --batch requires a batch variant of the"
+                   " function (cr_function_under_test_n)\n");
+          exit (1);
+#endif
+          batch = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--shard") == 0 && argc >= 3)
+        {
+          if (sscanf (argv[2], "%d/%d", &shard_k, &shard_n) != 2
+              || shard_n < 1 || shard_k < 1 || shard_k > shard_n)
+          {
+            fprintf (stderr, "Error, invalid shard %s (should be k/N with"
+                     " 1 <= k <= N)\n", argv[2]);
+            exit (1);
+          }
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--checkpoint") == 0 && argc >= 3)
+        {
+          checkpoint_file = argv[2];
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--known-failures") == 0 && argc >= 3)
+        {
+#ifndef CORE_MATH_DIFF
+          fprintf (stderr, "Error, --known-failures is only used by the"
+                   " differential check\n");
+          exit (1);
+#endif
+          known_file = argv[2];
+          argc -= 2;
+          argv += 2;
+        }
+      else if (strcmp (argv[1], "--golden") == 0 && argc >= 3)
+        {
+#ifdef CORE_MATH_DIFF
+          /* the reference values would only be computed for a few inputs */
+          fprintf (stderr, "Error, --golden is not supported by the"
+                   " differential check\n");
+          exit (1);
+#endif
+          golden_file = argv[2];
+          argc -= 2;
+          argv += 2;
+        }
       else
         {
           fprintf (stderr, "Error, unknown option %s\n", argv[1]);
@@ -131,5 +769,27 @@ main (int argc, char *argv[])
         }
     }
 
-  return doloop();
+  if (batch && (golden_file != NULL || checkpoint_file != NULL
+                || known_file != NULL))
+  {
+    fprintf (stderr, "Error, --batch does not support --golden, --checkpoint"
+             " or --known-failures\n");
+    exit (1);
+  }
+
+  if (golden_file != NULL)
+    golden_open (golden_file);
+#ifdef CHECK_BATCH
+  int ret = batch ? check_range (0, 0x3fffffff, batch_add) : doloop ();
+#else
+  int ret = doloop ();
+#endif
+  if (golden_file != NULL)
+    golden_close ();
+#ifdef CORE_MATH_DIFF
+  if (known_complete)
+    printf ("%lu input(s) where the two versions differ or the other one"
+            " failed\n", diffs);
+#endif
+  return ret;
 }
@@ -1,18 +1,19 @@
 #define cr_function_under_test cr_tanf
+#define cr_function_under_test_n cr_tanf_n
 #define ref_function_under_test ref_tan
 
 void doit (uint32_t n);
 static inline uint32_t asuint (float f);
 
+static void
+check_one (uint32_t n)
+{
+  doit (n);
+  doit (n | 0x80000000);
+}
+
 static inline int doloop (void)
 {
   uint32_t nmin = asuint (0x1p-149f), nmax = asuint (0x1.fffffep127f);
-#pragma omp parallel for
-  for (uint32_t n = nmin; n <= nmax; n++)
-  {
-    doit (n);
-    doit (n | 0x80000000);
-  }
-  printf ("all ok\n");
-  return 0;
+  return check_range (nmin, nmax, check_one);
 }
@@ -24,10 +24,15 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#include <stddef.h>
 #include <stdint.h>
 #include <fenv.h>
 #include <errno.h>
 
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
@@ -119,6 +124,11 @@ static double __attribute__((noinline)) rbig(uint32_t u, int *q){
   return z;
 }
 
+// shared by cr_tanf() and cr_tanf_n()
+static const double cn[] = {0x1.921fb54442d18p+0, -0x1.fd226e573289fp-2, 0x1.b7a60c8dac9f6p-6, -0x1.725beb40f33e5p-13};
+static const double cd[] = {0x1p+0, -0x1.2395347fb829dp+0, 0x1.2313660f29c36p-3, -0x1.9a707ab98d1c1p-9};
+static const double s[] = {0, 1};
+
 float cr_tanf(float x){
   b32u32_u t = {.f = x};
   int e = (t.u>>23)&0xff, i;
@@ -140,9 +150,6 @@ float cr_tanf(float x){
     return __builtin_nanf("tinf"); // inf
   }
   double z2 = z*z, z4 = z2*z2;
-  static const double cn[] = {0x1.921fb54442d18p+0, -0x1.fd226e573289fp-2, 0x1.b7a60c8dac9f6p-6, -0x1.725beb40f33e5p-13};
-  static const double cd[] = {0x1p+0, -0x1.2395347fb829dp+0, 0x1.2313660f29c36p-3, -0x1.9a707ab98d1c1p-9};
-  static const double s[] = {0, 1};
   double n = cn[0] + z2*cn[1], n2 = cn[2] + z2*cn[3]; n += z4*n2;
   double d = cd[0] + z2*cd[1], d2 = cd[2] + z2*cd[3]; d += z4*d2;
   n *= z;
@@ -173,3 +180,128 @@ float cr_tanf(float x){
   }
   return r1;
 }
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* Number of arguments evaluated together by cr_tanf_n(). */
+#define TANF_N_LANES 8
+/* Number of arguments cr_tanf_n() may leave to cr_tanf() before it
+   evaluates them. */
+#define TANF_N_QUEUE 64
+
+/* Same as cr_tanf() for 115 <= e < 127+28 on the 4 lanes of x, where the
+   argument is reduced by rltl().  The operations are those of cr_tanf(), in
+   the same order, thus each lane of y is bit-identical to r1 in cr_tanf(x).
+   Return the mask of the lanes in that range for which the tail test of
+   cr_tanf() succeeds, i.e., for which cr_tanf(x) returns r1. */
+static inline unsigned
+tanf_fast_avx2 (float *y, __m128 x)
+{
+  // 115 <= e < 127+28
+  __m128i u = _mm_and_si128 (_mm_castps_si128 (x), _mm_set1_epi32 (0x7fffffff));
+  __m128i v = _mm_sub_epi32 (u, _mm_set1_epi32 (115 << 23));
+  __m128i lim = _mm_set1_epi32 (((127 + 28) << 23) - (115 << 23) - 1);
+  __m128i in = _mm_cmpeq_epi32 (_mm_min_epu32 (v, lim), v);
+  // 1 is a dummy argument for the other lanes
+  __m256d xd = _mm256_cvtps_pd (_mm_blendv_ps (_mm_set1_ps (1.0f), x,
+                                               _mm_castsi128_ps (in)));
+
+  // rltl()
+  __m256d idl = _mm256_mul_pd (_mm256_set1_pd (-0x1.b1bbead603d8bp-32), xd);
+  __m256d idh = _mm256_mul_pd (_mm256_set1_pd (0x1.45f306ep-1), xd);
+  __m256d id = _mm256_round_pd (idh, _MM_FROUND_TO_NEAREST_INT
+                                     | _MM_FROUND_NO_EXC);
+  __m256d z = _mm256_add_pd (_mm256_sub_pd (idh, id), idl);
+  // |id| < 2^28, thus the conversion is exact
+  __m128i i = _mm256_cvtpd_epi32 (id);
+
+  __m256d z2 = _mm256_mul_pd (z, z), z4 = _mm256_mul_pd (z2, z2);
+  __m256d n = _mm256_add_pd (_mm256_set1_pd (cn[0]),
+                             _mm256_mul_pd (z2, _mm256_set1_pd (cn[1])));
+  __m256d n2 = _mm256_add_pd (_mm256_set1_pd (cn[2]),
+                              _mm256_mul_pd (z2, _mm256_set1_pd (cn[3])));
+  n = _mm256_add_pd (n, _mm256_mul_pd (z4, n2));
+  __m256d d = _mm256_add_pd (_mm256_set1_pd (cd[0]),
+                             _mm256_mul_pd (z2, _mm256_set1_pd (cd[1])));
+  __m256d d2 = _mm256_add_pd (_mm256_set1_pd (cd[2]),
+                              _mm256_mul_pd (z2, _mm256_set1_pd (cd[3])));
+  d = _mm256_add_pd (d, _mm256_mul_pd (z4, d2));
+  n = _mm256_mul_pd (n, z);
+  // s0 = s[i&1] and s1 = s[1-(i&1)]
+  __m256d odd = _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (_mm_cmpeq_epi32 (
+    _mm_and_si128 (i, _mm_set1_epi32 (1)), _mm_set1_epi32 (1))));
+  __m256d s0 = _mm256_and_pd (odd, _mm256_set1_pd (s[1]));
+  __m256d s1 = _mm256_andnot_pd (odd, _mm256_set1_pd (s[1]));
+  __m256d r1 = _mm256_div_pd (
+    _mm256_sub_pd (_mm256_mul_pd (n, s1), _mm256_mul_pd (d, s0)),
+    _mm256_add_pd (_mm256_mul_pd (n, s0), _mm256_mul_pd (d, s1)));
+  _mm_storeu_ps (y, _mm256_cvtpd_ps (r1));
+
+  // tail = (tr.u + 7)&(~0ul>>35) <= 14 for the database arguments
+  __m256i tail = _mm256_and_si256 (
+    _mm256_add_epi64 (_mm256_castpd_si256 (r1), _mm256_set1_epi64x (7)),
+    _mm256_set1_epi64x (~0ul >> 35));
+  unsigned hard = _mm256_movemask_pd (_mm256_castsi256_pd (
+    _mm256_cmpgt_epi64 (_mm256_set1_epi64x (15), tail)));
+  return _mm_movemask_ps (_mm_castsi128_ps (in)) & ~hard;
+}
+
+/* Arguments left by cr_tanf_n() to cr_tanf(): y[k[i]] = cr_tanf(x[i]) for
+   0 <= i < n.  The arguments are copied since x and y may be equal. */
+typedef struct {
+  size_t k[TANF_N_QUEUE];
+  float x[TANF_N_QUEUE];
+  int n;
+} tanf_queue_t;
+
+static void __attribute__((noinline))
+tanf_queue_flush (tanf_queue_t *q, float *y)
+{
+  for (int i = 0; i < q->n; i++)
+    y[q->k[i]] = cr_tanf (q->x[i]);
+  q->n = 0;
+}
+
+/* Evaluate tanf on x[k] to x[k+TANF_N_LANES-1], four at a time.  The lanes
+   not handled by tanf_fast_avx2() (tiny, huge, infinite or NaN arguments,
+   and those which may be in the database) are appended to q, so that a
+   single argument reduced by rbig() does not stall the vector loop. */
+static inline void
+tanf_n_block (const float *x, float *y, size_t k, tanf_queue_t *q)
+{
+  // both halves are loaded before y is written, in case x == y
+  __m128 x0 = _mm_loadu_ps (x + k), x1 = _mm_loadu_ps (x + k + 4);
+  unsigned bad = ~(tanf_fast_avx2 (y + k, x0)
+                   | tanf_fast_avx2 (y + k + 4, x1) << 4)
+    & ((1u << TANF_N_LANES) - 1);
+  if (__builtin_expect (bad != 0, 0))
+  {
+    float xs[TANF_N_LANES];
+    _mm_storeu_ps (xs, x0);
+    _mm_storeu_ps (xs + 4, x1);
+    do {
+      int j = __builtin_ctz (bad);
+      bad &= bad - 1;
+      if (q->n == TANF_N_QUEUE)
+        tanf_queue_flush (q, y);
+      q->k[q->n] = k + j;
+      q->x[q->n++] = xs[j];
+    } while (bad);
+  }
+}
+#endif
+
+/* Sets y[k] = cr_tanf(x[k]) for 0 <= k < n.  x and y may be equal. */
+void
+cr_tanf_n (const float *x, float *y, size_t n)
+{
+  size_t k = 0;
+#if defined(__AVX2__) && defined(__FMA__)
+  tanf_queue_t q;
+  q.n = 0;
+  for (; k + TANF_N_LANES <= n; k += TANF_N_LANES)
+    tanf_n_block (x, y, k, &q);
+  tanf_queue_flush (&q, y);
+#endif
+  for (; k < n; k++)
+    y[k] = cr_tanf (x[k]);
+}
@@ -24,15 +24,57 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/acos.h"
+#include "core-math/stats.h"
+
 #include <stdint.h>
+#include <fenv.h>
 #include <errno.h>
 
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __attribute__
+#define __attribute__(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_copysign
+#define __builtin_copysign(x, y) std::copysign(x, y)
+#endif
+#ifndef __builtin_sqrt
+#define __builtin_sqrt(x) std::sqrt(x)
+#endif
+#ifndef __builtin_roundeven
+// roundsd with imm8 = 8: round to nearest-even, independently of the
+// current rounding mode, and do not raise the inexact exception.
+#define __builtin_roundeven(x) \
+  _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(x), \
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+#endif
+#endif
 
 typedef uint64_t u64;
 typedef int64_t i64;
@@ -88,7 +130,8 @@ static inline double polydd(double xh, double xl, int n, const double c[][2], do
 
 static double __attribute__((noinline)) as_acos_refine(double, double);
 
-double cr_acos (double x){
+double __cdecl cr_acos (double x){
+  CORE_MATH_STATS_COUNT(ACOS, calls);
   // coefficients of a polynomial approximation of asin(x):
   // asin(x) = x*(cc[j][0] + cc[j][1] + t*P(t, cc[j] + 2))
   // where t = x^2 - j/128
@@ -164,15 +207,17 @@ double cr_acos (double x){
   b64u64_u ix = {.f = x};
   u64 ax = ix.u<<1;
   double t,z,zl,jd,f0h,f0l;
-  if(ax>0x7fc0000000000000ul){ // |x|>0.5
+  if(ax>0x7fc0000000000000ull){ // |x|>0.5
     static const double off[][2] = {{0,0}, {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53}};
     i64 k = ix.u>>63;
     f0h = off[k][0];
     f0l = off[k][1];
-    if(__builtin_expect(ax>=0x7fe0000000000000ul, 0)){ // |x| >= 1
-      if(ax==0x7fe0000000000000ul) return f0h + f0l; // |x| = 1
-      if(ax>0xffe0000000000000ul) return x; // nan
+    if(__builtin_expect(ax>=0x7fe0000000000000ull, 0)){ // |x| >= 1
+      if(ax==0x7fe0000000000000ull) return f0h + f0l; // |x| = 1
+      if(ax>0xffe0000000000000ull) return x; // nan
+#ifndef CORE_MATH_NO_SIDE_EFFECTS
       errno = EDOM;
+#endif
       return 0./0.; // |x|>1
     }
     // for x>0.5 we use range reduction for double angle formula
@@ -197,7 +242,7 @@ double cr_acos (double x){
   }
   // asin(xh+xl) = (xh + xl)*(cc[j][0] + (cc[j][1] + t*Poly(t, cc[j]+2)))
   // where t = xh^2 - j/128 and j = round(128*xh^2)
-  long j = jd;
+  int64_t j = jd;
   const double *c = cc[j];
   double t2 = t*t, d = t*((c[2] + t*c[3]) + t2*((c[4] + t*c[5]) + t2*(c[6] + t*c[7])));
   double fh = c[0], fl = c[1] + d;
@@ -206,10 +251,12 @@ double cr_acos (double x){
   double eps = __builtin_fabs(z*t)*0x1.38p-52 + 0x1p-105;
   double lb = fh + (fl - eps), ub = fh + (fl + eps);
   if(__builtin_expect(lb!=ub, 0)) return as_acos_refine(x, lb);
+  CORE_MATH_STATS_COUNT(ACOS, fast);
   return lb;
 }
 
 double as_acos_refine(double x, double phi){
+  CORE_MATH_STATS_COUNT(ACOS, accurate);
   // Consider x as sin(phi) then cos(phi) is ch + cl = sqrt(1-x^2)
   // Using angle rotation formula bring the argument close to zero
   // where the asin Taylor expansion works well.
@@ -222,7 +269,7 @@ double as_acos_refine(double x, double phi){
   double ch = __builtin_sqrt(c2f);
   double cl = (c2l - __builtin_fma(ch,ch,-c2f))*((0.5/c2f)*ch);
 
-  long jf = __builtin_roundeven(__builtin_fabs(phi - 0x1.921fb54442d18p+0) * 0x1.45f306dc9c883p+4);
+  int64_t jf = __builtin_roundeven(__builtin_fabs(phi - 0x1.921fb54442d18p+0) * 0x1.45f306dc9c883p+4);
   // sin(pi/64*j) in the double-double format
   static const double s[33][2] = {
     {0x0p+0, 0x0p+0}, {-0x1.912bd0d569a9p-61, 0x1.91f65f10dd814p-5},
@@ -282,15 +329,23 @@ double as_acos_refine(double x, double phi){
   e = 52-(107+e);
   e = e<0?0:e;
   e = e>52?52:e;
-  u64 m = (1ul<<52)-(1ul<<e);
-  if(__builtin_expect(!((t.u+(1l<<(e-1)))&m), 0)){
-    if(x==-0x1.771164bfd1f84p-3 ) return 0x1.c14601daaf657p+0  - 0x1p-54;
-    if(x==-0x1.4510ee8eb4e67p-1 ) return 0x1.211c0e2c2559ep+1  - 0x1p-53;
-    if(x==-0x1.011c543f23a17p-2 ) return 0x1.d318c90d9e8b7p+0  - 0x1p-54;
-    if(x== 0x1.ffffffffffdc0p-1 ) return 0x1.8000000000024p-22 + 0x1p-76;
-    if(x== 0x1.53ea6c7255e88p-4 ) return 0x1.7cdacb6bbe707p+0  + 0x1p-54;
-    if(x== 0x1.fd737be914578p-11) return 0x1.91e006d41d8d8p+0  + 0x1p-54;
-    if(x== 0x1.fffffffffff70p-1 ) return 0x1.8000000000009p-23 + 0x1p-77;
+  u64 m = (1ull<<52)-(1ull<<e);
+  if(__builtin_expect(!((t.u+(1ll<<(e-1)))&m), 0)){
+    static const double db[][3] = {
+      {-0x1.771164bfd1f84p-3 , 0x1.c14601daaf657p+0 , -0x1p-54},
+      {-0x1.4510ee8eb4e67p-1 , 0x1.211c0e2c2559ep+1 , -0x1p-53},
+      {-0x1.011c543f23a17p-2 , 0x1.d318c90d9e8b7p+0 , -0x1p-54},
+      { 0x1.ffffffffffdc0p-1 , 0x1.8000000000024p-22,  0x1p-76},
+      { 0x1.53ea6c7255e88p-4 , 0x1.7cdacb6bbe707p+0 ,  0x1p-54},
+      { 0x1.fd737be914578p-11, 0x1.91e006d41d8d8p+0 ,  0x1p-54},
+      { 0x1.fffffffffff70p-1 , 0x1.8000000000009p-23,  0x1p-77},
+    };
+    for(unsigned i=0;i<sizeof(db)/sizeof(db[0]);i++){
+      if(x==db[i][0]){
+        CORE_MATH_STATS_COUNT(ACOS, database);
+        return db[i][1] + db[i][2];
+      }
+    }
     b64u64_u w = {.f = ps};
     if((w.u^t.u)>>63)
       t.u--;
@@ -24,24 +24,63 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/asin.h"
+#include "core-math/stats.h"
+
 #include <errno.h>
 #include <math.h>
 #include <fenv.h>
+#include <stdint.h>
 
 #ifdef __x86_64__
 #include <x86intrin.h>
 #endif
 
+#include <bit>
+#include <cmath>
+
+#include "absl/numeric/int128.h"
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __builtin_clzll
+#define __builtin_clzll(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_copysign
+#define __builtin_copysign(x, y) std::copysign(x, y)
+#endif
+#ifndef __builtin_nan
+#define __builtin_nan(x) std::nan(x)
+#endif
+#ifndef __builtin_sqrt
+#define __builtin_sqrt(x) std::sqrt(x)
+#endif
+#endif
 
 static inline int get_rounding_mode (void)
 {
-#ifdef __x86_64__
+#if defined(CORE_MATH_ROUNDING)
+  return CORE_MATH_ROUNDING;
+#elif defined(__x86_64__)
   const unsigned flagp = _mm_getcsr ();
   return (flagp&(3<<13))>>3;
 #else
@@ -49,17 +88,17 @@ static inline int get_rounding_mode (void)
 #endif
 }
 
-typedef unsigned __int128 u128;
-typedef __int128 i128;
-typedef unsigned long u64;
-typedef long i64;
+typedef absl::uint128 u128;
+typedef absl::int128 i128;
+typedef uint64_t u64;
+typedef int64_t i64;
 typedef union {u128 a; u64 b[2];} u128_u;
-typedef union {double f; unsigned long u;} b64u64_u;
+typedef union {double f; u64 u;} b64u64_u;
 
 inline static void shl(u128_u *a, int n){(*a).a <<= n;}
 inline static void shr(u128_u *a, int n){(*a).a >>= n;}
 
-inline static u64 muuh(u64 a, u64 b){return (a*(u128)b)>>64;}
+inline static u64 muuh(u64 a, u64 b){return absl::Uint128High64(a*(u128)b);}
 inline static i64 mh(i64 a, i64 b){return (i64)((a*(i128)b)>>64);}
 inline static i128 imul(i64 a, i64 b){return a*(i128)b;}
 inline static u128 mUU(u128 a, u128 b){
@@ -85,7 +124,7 @@ inline static u128 sqrU(u128 a){
 }
 
 static u128 pasin(u128 x){
-  u64 xh = x>>64;
+  u64 xh = absl::Uint128High64(x);
   static const u64 b[] = {0x5ba2e8ba2e8ad9b7, 0x0004713b13b29079, 0x000000393331e196, 0x0000000002f5c315};
   static const u128_u ch[] = {
     {.b = {0xaaaaaaaaaaaaaaa5, 0x0002aaaaaaaaaaaa}}, // *+1
@@ -99,6 +138,7 @@ static u128 pasin(u128 x){
 }
 
 static double asin_acc(double x){
+  CORE_MATH_STATS_COUNT(ASIN, accurate);
   static const u128_u s[] =
     {{.b = {0x4e29cf6e5fed0679, 0x648557de8d99f7e}},
      {.b = {0x76a17954b2b7c517, 0xc8fb2f886ec09f3}},{.b = {0xbeeeae8129a786b9, 0x12d52092ce19f5cc}},
@@ -138,10 +178,10 @@ static double asin_acc(double x){
   const unsigned rm = get_rounding_mode ();
   b64u64_u t = {.f = x};
   int se = ((t.u>>52)&0x7ff)-0x3ff;
-  i64 xsign = t.u&(1l<<63);
+  i64 xsign = t.u&(1ll<<63);
   double ax = __builtin_fabs(x);
   u128_u fi;
-  u64 sm = (t.u<<11)|1l<<63;
+  u64 sm = (t.u<<11)|1ll<<63;
   u128_u sm2 = {.a = (u128)sm * sm};
   if(__builtin_expect(ax<0.0131875,0)) {
     int ss = 2*se;
@@ -159,8 +199,8 @@ static double asin_acc(double x){
     double c2 = ch[2] + ax*ch[3];
     c0 += x2*c2;
     b64u64_u ic = {.f = c0*c.f + 64.0};
-    int indx = ((ic.u&(~0ul>>12)) + (1l<<(52-7)))>>(52-6);
-    u64 cm = (c.u<<11)|1l<<63; int ce = (c.u>>52) - 0x3ff;
+    int indx = ((ic.u&(~0ull>>12)) + (1ll<<(52-7)))>>(52-6);
+    u64 cm = (c.u<<11)|1ll<<63; int ce = (c.u>>52) - 0x3ff;
     u128_u cm2 = {.a = (u128)cm * cm};
     const int off = 36 - 22 + 14;
     int ss = 128 - 104 + 2*se + off;
@@ -169,7 +209,7 @@ static double asin_acc(double x){
     shl(&cm2, sc);
     sm2.a += cm2.a;
     i64 h = sm2.b[1];
-    u64 ixm = (ixx.u&(~0ul>>12))|1l<<52; int ixe = (ixx.u>>52) - 0x3ff;
+    u64 ixm = (ixx.u&(~0ull>>12))|1ll<<52; int ixe = (ixx.u>>52) - 0x3ff;
     i64 dc = mh(h, ixm);
     u128_u dsm2 = {.a = (u128)imul(dc,cm>>1)};
     dsm2.a <<= 13;
@@ -185,7 +225,7 @@ static double asin_acc(double x){
     ss = 24 + k;
     u128_u Cm = {.b = {0, cm}}, D = {.b = {(u64)dc << ss, (u64)(dc>>-ss)}};
     Cm.a -= D.a;
-    h = sm2.a>>14;
+    h = absl::Uint128Low64(sm2.a>>14);
     dc = mh(h, ixm);
     ss = 26-k;
     if(__builtin_expect(ss>=0,1))
@@ -202,10 +242,10 @@ static double asin_acc(double x){
       Cm.a += mUU(Cm.a, z.a);
       fi.a -= Cm.a>>7;
     } else {
-      i128 v = muU(sm>>-se, s[indx-1].a) - (mUU(Cm.a,s[63-indx].a)>>-ce), msk = v>>127, v2 = sqrU(v) - (msk&(v+v));
+      i128 v = (i128)(muU(sm>>-se, s[indx-1].a) - (mUU(Cm.a,s[63-indx].a)>>-ce)), msk = v>>127, v2 = (i128)(sqrU(v) - (msk&(v+v)));
       v2 <<= 14;
       u128 p = pasin(v2);
-      v += mUU(p,v)-(msk&p);
+      v += (i128)(mUU(p,v)-(msk&p));
       fi.a += v;
     }
     se = 0x3fe;
@@ -225,7 +265,8 @@ static double asin_acc(double x){
   return t.f;
 }
 
-double cr_asin(double x){
+double __cdecl cr_asin(double x){
+  CORE_MATH_STATS_COUNT(ASIN, calls);
   /* For 0 <= i <= 64, s[i]=floor(sin(pi/2*i/64)*2^63), except for i=64
      where s[i]=2^63-1.
      Thus s[i]/2^63 approximates sin(pi/2*i/64)=cos(pi/2*(64-i)/64).
@@ -248,7 +289,7 @@ double cr_asin(double x){
     0x7641af3cca3518a2, 0x776c4edb3308f183, 0x78848413da1b92fe, 0x798a23b1238447ba, 
     0x7a7d055b18b76976, 0x7b5d039da1258cf4, 0x7c29fbee48c35ca9, 0x7ce3ceb193962314, 
     0x7d8a5f3fdd72c0ab, 0x7e1d93e9c52ea4d5, 0x7e9d55fc22945a85, 0x7f0991c3867f4d1e, 
-    0x7f62368f44949678, 0x7fa736b40620e854, 0x7fd8878de5b5f78e, 0x7ff62182133432ec, ~0ul>>1 };
+    0x7f62368f44949678, 0x7fa736b40620e854, 0x7fd8878de5b5f78e, 0x7ff62182133432ec, ~0ull>>1 };
   /* For 0 <= i <= 64, sh[i] = round(sin(i*pi/2/64)*2^69) mod 2^64,
      with maximal error < 0.496 (for i=17). */
   static const u64 sh[] = {
@@ -286,9 +327,9 @@ double cr_asin(double x){
   b64u64_u t = {.f = x};
   int e = ((t.u>>52)&0x7ff)-0x3ff;
   /* x = 2^e*y with 1 <= |y| < 2 */
-  i64 xsign = t.u&(1l<<63);
+  i64 xsign = t.u&(1ll<<63);
   /* xsign=0 for x > 0, xsign=1 for x < 0 */
-  u64 sm = (t.u<<11)|1l<<63;
+  u64 sm = (t.u<<11)|1ll<<63;
   /* sm contains in its high 53 bits: the implicit leading bit, and the
      the 52 explicit bits from the significand, thus |x| = 2^(e+1)*sm/2^64
      where 2^63 <= sm < 2^64 */
@@ -301,8 +342,10 @@ double cr_asin(double x){
       return __builtin_copysign (0x1.921fb54442d18p+0, x)
         + __builtin_copysign (0x1.1a62633145c07p-54, x);
     if (e==0x400 && m) return x; // nan
+#ifndef CORE_MATH_NO_SIDE_EFFECTS
     errno = EDOM;
     feraiseexcept (FE_INVALID);
+#endif
     return __builtin_nan (">1");
   } else if (__builtin_expect(e < -6,0)){ /* |x| < 2^-6 */
     if (__builtin_expect (e < -26,0)) /* |x| < 2^-26 */
@@ -350,7 +393,7 @@ double cr_asin(double x){
        * 2^(84-82.731) < 3 between asin(x)-x and the b[] polynomial
        * 10/2^64 for the total rounding error in d
        Thus the total error is bounded by 3+10=13 (which means we can put
-       u.a += 12l<<ss below, since the error is below 13, and the left
+       u.a += 12ll<<ss below, since the error is below 13, and the left
        bound is exact, thus adding 12.999 cannot yield any borrow).
      */
     int ss = 63 + 2*e;
@@ -361,7 +404,7 @@ double cr_asin(double x){
     /* the number of leading zeros in fi.b[1] is usually 1, but it can also
        be 0, for example for x=0x1.fffffffffffffp-7, thus nz is 0, 1 or 2 */
     u128_u u = fi;
-    u.a += 12l<<ss;
+    u.a += 12ll<<ss;
     /* Here fi is the 'left' approximation, and u is the 'right' approximation,
        with error bounded by 9 ulp(d). We check the last bit (or the round bit
        for FE_TONEAREST) does not change between fi and u. */
@@ -401,7 +444,7 @@ double cr_asin(double x){
     c0 += 64;
     /* now c0 approximates 64+64*acos(x)/(pi/2), which lies in [64,128] */
     b64u64_u ic = {.f = c0};
-    int indx = ((ic.u&(~0ul>>12)) + (1l<<(52-7))) >> (52-6);
+    int indx = ((ic.u&(~0ull>>12)) + (1ll<<(52-7))) >> (52-6);
     /* indx = round(c0)-64. We have indx < 64 since c0 is decreasing with
        |x|, thus the largest value is obtained for |x| = 2^-6, and for this
        value we get c0 = 0x1.fd637111d9943p+6 = 127.347111014276
@@ -413,7 +456,7 @@ double cr_asin(double x){
        thus:
        y = y[i] + asin(x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]))
        where x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]) is small. */
-    u64 cm = (c.u<<11)|1l<<63; int ce = (c.u>>52) - 0x3ff;
+    u64 cm = (c.u<<11)|1ll<<63; int ce = (c.u>>52) - 0x3ff;
     /* cm contains in its high bits the 53 significant bits from c,
        which approximates sqrt(1-x^2), including the implicit bit,
        ce is the corresponding exponent, such that c = 2^ce*cm/2^63.
@@ -447,7 +490,7 @@ double cr_asin(double x){
     i64 h = sm2.b[1];
     /* h/2^64 approximates 2^50*(x^2+c^2) mod 1, with error bounded by
        1/2^64 for the truncated part sm2.b[0]/2^128. */
-    u64 ixm = (ixx.u&(~0ul>>12))|1l<<52; int ixe = (ixx.u>>52) - 0x3ff;
+    u64 ixm = (ixx.u&(~0ull>>12))|1ll<<52; int ixe = (ixx.u>>52) - 0x3ff;
     /* ixx = ixm*2^(ixe-52) */
     /* x*cos(y[i]) - sqrt(1-x^2)*sin(y[i]) is computed as
        (x-sin(y[i]))*cos(y[i]) - (sqrt(1-x^2)-cos(y[i]))*sin(y[i]) */
@@ -519,7 +562,7 @@ double cr_asin(double x){
     u64 Vh = v>>5, Vl = v<<59;
     /* the maximal error 24.08 on v translates into an error of 24.08*2^59
        on Vl */
-    i128 V = (u128)Vh<<64|Vl;
+    i128 V = (i128)((u128)Vh<<64|Vl);
     fi.a += V;
     /* now fi/2^127 approximates asin(|x|) */
 
@@ -527,13 +570,13 @@ double cr_asin(double x){
     u128_u u = fi, d = fi;
     /* The error is bounded by 24.08*2^59 here, thus by 386*2^55.
        For reference, the original (non proven) error bounds are:
-       u.a += 50l<<55 and d.a -= 27l<<55. */
-    u.a += 386l<<55;
-    d.a -= 386l<<55;
+       u.a += 50ll<<55 and d.a -= 27ll<<55. */
+    u.a += 386ll<<55;
+    d.a -= 386ll<<55;
     if( __builtin_expect(((d.b[1]^u.b[1])>>(11-nz))&1, 0)){
       return asin_acc(x);
     }
-    e = 0x3fel;
+    e = 0x3fell;
   }
 
   int nz = __builtin_clzll(fi.b[1]);
@@ -548,5 +591,6 @@ double cr_asin(double x){
     rnd = 0;
   }
   t.u = ((fi.b[1]>>(11-nz))+((u64)(e-nz)<<52|rnd))|xsign;
+  CORE_MATH_STATS_COUNT(ASIN, fast);
   return t.f;
 }
@@ -28,21 +28,59 @@ SOFTWARE.
    who designed the code to generate a rational approximation of atan(z)
    over (0,1). See comments before P[] and Q[] below. */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/atan2.h"
+#include "core-math/stats.h"
+
 #include <stdio.h> // needed in case of correct rounding failure
 #include <stdint.h>
+#include <fenv.h>
+
+#include <bit>
+#include <cmath>
 
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __attribute__
+#define __attribute__(x)
+#endif
+#ifndef __builtin_clzl
+#define __builtin_clzl(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_trunc
+#define __builtin_trunc(x) std::trunc(x)
+#endif
+#ifndef __builtin_copysign
+#define __builtin_copysign(x, y) std::copysign(x, y)
+#endif
+#ifndef __builtin_ldexp
+#define __builtin_ldexp(x, y) std::ldexp(x, y)
+#endif
+#endif
 
 typedef union { double f; uint64_t u; } d64u64;
 
 #include "tint.h"
 
-#define MASK 0x7ffffffffffffffful // 2^63-1 (mask the sign bit)
+#define MASK 0x7fffffffffffffffull // 2^63-1 (mask the sign bit)
 
 // assume sign bit was removed
 static inline int is_nan (uint64_t u)
@@ -54,7 +92,7 @@ static inline int is_nan (uint64_t u)
 // assume sign bit was removed
 static inline int is_inf (uint64_t u)
 {
-  return u == (0x7fful << 52);
+  return u == (0x7ffull << 52);
 }
 
 // PI_H+PI_L approximates pi with error bounded by 2^-108.041
@@ -140,75 +178,76 @@ Denominator = [|
 0x3.3292e4119e1a4df48cf079a47049f07fd24f82de8f791668p-28|];
 */
 static const tint_t P[30] = {
-   {.h=0x82703f8b53112eca, .m=0x71ce6279d467aa45, .l=0x19c9b28466b6fc0, .ex=-10, .sgn=0},
-   {.h=0xb3cf74b427d53e03, .m=0xee590b839e751890, .l=0xf2570b12bcb2381a, .ex=-8, .sgn=0},
-   {.h=0xb08498b17b88c39a, .m=0x11e37821d784d8fa, .l=0x2795b14b84b9d78c, .ex=-6, .sgn=0},
-   {.h=0xfd4baa7bb52b0d83, .m=0xb25425beb0a04dc3, .l=0x92008d9fb34b68ff, .ex=-5, .sgn=0},
-   {.h=0x96541948b85fb386, .m=0xe0b815ace425a859, .l=0xbeca17c69bb4f7a0, .ex=-3, .sgn=0},
-   {.h=0x96aaa5d4baffc590, .m=0xf23db783b6e4ce55, .l=0x2c54e054d3b69f7e, .ex=-2, .sgn=0},
-   {.h=0x83cd41b5fa862b11, .m=0xad8f9d6e3eb9d833, .l=0x4ef470d801fa03ca, .ex=-1, .sgn=0},
-   {.h=0xcbbc7752197cc106, .m=0xbc66cfb3edefa6e3, .l=0x568b2f9e4feb8910, .ex=-1, .sgn=0},
-   {.h=0x8cf8f7c585767042, .m=0xcd92a5b9ac13d8c8, .l=0x43bd4a023dbe04d, .ex=0, .sgn=0},
-   {.h=0xafdc36d6b36139bf, .m=0x11df63474e3859d4, .l=0x42b30b2c089a2b6c, .ex=0, .sgn=0},
-   {.h=0xc6f8fb1463822519, .m=0x2f9f04cf55c10377, .l=0x1c44675c6d483606, .ex=0, .sgn=0},
-   {.h=0xcce79f10f754e315, .m=0x91ce47edcbc8a4ee, .l=0xb2a6f721ac656b42, .ex=0, .sgn=0},
-   {.h=0xc090384dbd77132e, .m=0x1dfb4d9a1d595de7, .l=0xe506ca899a394f70, .ex=0, .sgn=0},
-   {.h=0xa556ac9eee25e867, .m=0xd84dafa25141d203, .l=0xf1c7c2a5156b3ec3, .ex=0, .sgn=0},
-   {.h=0x81bd2677ddfcbc38, .m=0x1df33f27dbb60939, .l=0xcb4c2c73286a6c29, .ex=0, .sgn=0},
-   {.h=0xb9ed12169d72e8d9, .m=0xc81d95dcef13c227, .l=0x974b95796b93c332, .ex=-1, .sgn=0},
-   {.h=0xf2df6da875b666fa, .m=0xc29dd3a69c274c65, .l=0x83b9260976c8f0c5, .ex=-2, .sgn=0},
-   {.h=0x902d34d4db910ed8, .m=0x6f3ecddfd6af0a9f, .l=0x8e950d7e70a8e9b2, .ex=-2, .sgn=0},
-   {.h=0x9aefa41961ce1207, .m=0xacd0317666753751, .l=0x3eaf42a53fcc6534, .ex=-3, .sgn=0},
-   {.h=0x95db9977c5e6e263, .m=0x85367a63fab8a720, .l=0xfc2b63bd115998d8, .ex=-4, .sgn=0},
-   {.h=0x817cb6d8236d5f4d, .m=0x70c7815f28909d9b, .l=0xc54e97155d12158, .ex=-5, .sgn=0},
-   {.h=0xc5eec4228c352098, .m=0x789e56be1dee9b67, .l=0xba25bda81292ccc1, .ex=-7, .sgn=0},
-   {.h=0x840c38ccfcb5dc64, .m=0xb55a44095bf7f312, .l=0x6668b8792d4ecd08, .ex=-8, .sgn=0},
-   {.h=0x97074af7b286b19e, .m=0xc20aac21f3130f1d, .l=0x369e9fdbdd48528a, .ex=-10, .sgn=0},
-   {.h=0x9054011c32d4b7a5, .m=0xc68d3c5d525f4af4, .l=0xeeb3c98615dee188, .ex=-12, .sgn=0},
-   {.h=0xdddb4a2eaab2bb15, .m=0x753761a8f0e9aa8d, .l=0x3f20620cd3e075bb, .ex=-15, .sgn=0},
-   {.h=0x80ef9a1b3e59abe5, .m=0x18e6afe0651fdf49, .l=0xd1c0329e6a702d9d, .ex=-17, .sgn=0},
-   {.h=0xca16dd49cd30854c, .m=0xbad8ca379401027c, .l=0x1fc7f47985486f16, .ex=-21, .sgn=0},
-   {.h=0xa0ba01b8742ba801, .m=0xe6dc14a9516d7f04, .l=0x1f5303d878905d2f, .ex=-25, .sgn=0},
-   {.h=0x9c0440896ce6515c, .m=0xcf3470fa7f10ac3, .l=0xa9dc80682c111a9d, .ex=-59, .sgn=1},
+   {.m=0x71ce6279d467aa45, .h=0x82703f8b53112eca, .l=0x19c9b28466b6fc0, .ex=-10, .sgn=0},
+   {.m=0xee590b839e751890, .h=0xb3cf74b427d53e03, .l=0xf2570b12bcb2381a, .ex=-8, .sgn=0},
+   {.m=0x11e37821d784d8fa, .h=0xb08498b17b88c39a, .l=0x2795b14b84b9d78c, .ex=-6, .sgn=0},
+   {.m=0xb25425beb0a04dc3, .h=0xfd4baa7bb52b0d83, .l=0x92008d9fb34b68ff, .ex=-5, .sgn=0},
+   {.m=0xe0b815ace425a859, .h=0x96541948b85fb386, .l=0xbeca17c69bb4f7a0, .ex=-3, .sgn=0},
+   {.m=0xf23db783b6e4ce55, .h=0x96aaa5d4baffc590, .l=0x2c54e054d3b69f7e, .ex=-2, .sgn=0},
+   {.m=0xad8f9d6e3eb9d833, .h=0x83cd41b5fa862b11, .l=0x4ef470d801fa03ca, .ex=-1, .sgn=0},
+   {.m=0xbc66cfb3edefa6e3, .h=0xcbbc7752197cc106, .l=0x568b2f9e4feb8910, .ex=-1, .sgn=0},
+   {.m=0xcd92a5b9ac13d8c8, .h=0x8cf8f7c585767042, .l=0x43bd4a023dbe04d, .ex=0, .sgn=0},
+   {.m=0x11df63474e3859d4, .h=0xafdc36d6b36139bf, .l=0x42b30b2c089a2b6c, .ex=0, .sgn=0},
+   {.m=0x2f9f04cf55c10377, .h=0xc6f8fb1463822519, .l=0x1c44675c6d483606, .ex=0, .sgn=0},
+   {.m=0x91ce47edcbc8a4ee, .h=0xcce79f10f754e315, .l=0xb2a6f721ac656b42, .ex=0, .sgn=0},
+   {.m=0x1dfb4d9a1d595de7, .h=0xc090384dbd77132e, .l=0xe506ca899a394f70, .ex=0, .sgn=0},
+   {.m=0xd84dafa25141d203, .h=0xa556ac9eee25e867, .l=0xf1c7c2a5156b3ec3, .ex=0, .sgn=0},
+   {.m=0x1df33f27dbb60939, .h=0x81bd2677ddfcbc38, .l=0xcb4c2c73286a6c29, .ex=0, .sgn=0},
+   {.m=0xc81d95dcef13c227, .h=0xb9ed12169d72e8d9, .l=0x974b95796b93c332, .ex=-1, .sgn=0},
+   {.m=0xc29dd3a69c274c65, .h=0xf2df6da875b666fa, .l=0x83b9260976c8f0c5, .ex=-2, .sgn=0},
+   {.m=0x6f3ecddfd6af0a9f, .h=0x902d34d4db910ed8, .l=0x8e950d7e70a8e9b2, .ex=-2, .sgn=0},
+   {.m=0xacd0317666753751, .h=0x9aefa41961ce1207, .l=0x3eaf42a53fcc6534, .ex=-3, .sgn=0},
+   {.m=0x85367a63fab8a720, .h=0x95db9977c5e6e263, .l=0xfc2b63bd115998d8, .ex=-4, .sgn=0},
+   {.m=0x70c7815f28909d9b, .h=0x817cb6d8236d5f4d, .l=0xc54e97155d12158, .ex=-5, .sgn=0},
+   {.m=0x789e56be1dee9b67, .h=0xc5eec4228c352098, .l=0xba25bda81292ccc1, .ex=-7, .sgn=0},
+   {.m=0xb55a44095bf7f312, .h=0x840c38ccfcb5dc64, .l=0x6668b8792d4ecd08, .ex=-8, .sgn=0},
+   {.m=0xc20aac21f3130f1d, .h=0x97074af7b286b19e, .l=0x369e9fdbdd48528a, .ex=-10, .sgn=0},
+   {.m=0xc68d3c5d525f4af4, .h=0x9054011c32d4b7a5, .l=0xeeb3c98615dee188, .ex=-12, .sgn=0},
+   {.m=0x753761a8f0e9aa8d, .h=0xdddb4a2eaab2bb15, .l=0x3f20620cd3e075bb, .ex=-15, .sgn=0},
+   {.m=0x18e6afe0651fdf49, .h=0x80ef9a1b3e59abe5, .l=0xd1c0329e6a702d9d, .ex=-17, .sgn=0},
+   {.m=0xbad8ca379401027c, .h=0xca16dd49cd30854c, .l=0x1fc7f47985486f16, .ex=-21, .sgn=0},
+   {.m=0xe6dc14a9516d7f04, .h=0xa0ba01b8742ba801, .l=0x1f5303d878905d2f, .ex=-25, .sgn=0},
+   {.m=0xcf3470fa7f10ac3, .h=0x9c0440896ce6515c, .l=0xa9dc80682c111a9d, .ex=-59, .sgn=1},
 };
 
 static const tint_t Q[30] = {
-   {.h=0x82703f8b53112eca, .m=0x71ce6279d467aa45, .l=0x19c9b28466b6fc0, .ex=-10, .sgn=0},
-   {.h=0xb3cf74b427d53e03, .m=0xee590b839e751890, .l=0xf2570b12bcb238cf, .ex=-8, .sgn=0},
-   {.h=0xb33c44af0d43c9e8, .m=0xf4426f84614701db, .l=0x979e49dc5b858442, .ex=-6, .sgn=0},
-   {.h=0x8264d256f0bf4d61, .m=0xee21431cc0f29764, .l=0xce0cc1b593ac9952, .ex=-4, .sgn=0},
-   {.h=0x9d97c4947687b2ee, .m=0xef4087c49dde5229, .l=0x742bc6e02bfb6df8, .ex=-3, .sgn=0},
-   {.h=0xa0f888dc7aab949e, .m=0xf623f19ac413db23, .l=0x854744a164f70ecd, .ex=-2, .sgn=0},
-   {.h=0x8fd9c7172ab0828e, .m=0x1a9f72fadafc3dfb, .l=0xaf96a180ea297178, .ex=-1, .sgn=0},
-   {.h=0xe38168b78a51ee15, .m=0x604a47815c8091eb, .l=0x9faaa42312e8eb30, .ex=-1, .sgn=0},
-   {.h=0xa164ccdbb65ee133, .m=0xe623433c5e086402, .l=0xcb228afd335a245f, .ex=0, .sgn=0},
-   {.h=0xced0c0cbe44fac2f, .m=0xd7c2adfc7c5dda9e, .l=0xa22b4a311cf5a5b1, .ex=0, .sgn=0},
-   {.h=0xf0e6660438c90371, .m=0x3dca1a0f58f0d943, .l=0x8a92b9de68c4488c, .ex=0, .sgn=0},
-   {.h=0x8000000000000000, .m=0x0, .l=0x0, .ex=1, .sgn=0},
-   {.h=0xf8ea68f9ad849103, .m=0xb257e4bfc606967f, .l=0x818fa2816928c4aa, .ex=0, .sgn=0},
-   {.h=0xddc64eeee3506234, .m=0x47a33ea40a2b22e4, .l=0xa6a2c129ace2470a, .ex=0, .sgn=0},
-   {.h=0xb52ddfba2d37c8e2, .m=0x24551a9b19fa064a, .l=0x3d78c68b54bc3850, .ex=0, .sgn=0},
-   {.h=0x87ac113d26b683a1, .m=0x4e97756c38785b0b, .l=0xf75f0a4506931ba8, .ex=0, .sgn=0},
-   {.h=0xba065070b900f3d5, .m=0xe49d8f9f238f1eeb, .l=0x6805d48d67f1dcd9, .ex=-1, .sgn=0},
-   {.h=0xe902d2a4bfc22441, .m=0x945cfe6c83a5b828, .l=0x519ebb457f8ccca0, .ex=-2, .sgn=0},
-   {.h=0x84e405c915f7769b, .m=0xfaaf34c3c51dd39, .l=0xa97fa0ae99382c93, .ex=-2, .sgn=0},
-   {.h=0x896da46c7e6cebb3, .m=0xe0afc0b6db3dbbf5, .l=0x61ccff6e78efff4, .ex=-3, .sgn=0},
-   {.h=0x801a0c1a0dfefc92, .m=0xf8e0a97902e08d47, .l=0x81898e0b7d8ef0bc, .ex=-4, .sgn=0},
-   {.h=0xd59d088930df07db, .m=0xa8cb00021849fbaf, .l=0xf80cc91aa0bddf89, .ex=-6, .sgn=0},
-   {.h=0x9db56a6984b77231, .m=0xcf7c2074e0480959, .l=0x3316ecaa6aa4604e, .ex=-7, .sgn=0},
-   {.h=0xcb7450d9d62d2e68, .m=0x9787b4265977d004, .l=0xba615cee00a841d7, .ex=-9, .sgn=0},
-   {.h=0xe12a52e02b64b23e, .m=0x97c9139a8ced716c, .l=0x70a176ad2b5f16d2, .ex=-11, .sgn=0},
-   {.h=0xd057b6d0900ed30d, .m=0x5e04bb17eb879a5e, .l=0x23ed135b60bea070, .ex=-13, .sgn=0},
-   {.h=0x9b1f1ca22fef7ae5, .m=0x19a687f0a4073eee, .l=0x5a9ccbc8c14578b, .ex=-15, .sgn=0},
-   {.h=0xaeba710f053aac3b, .m=0x30ea5d6fb116f775, .l=0x8a9bcfef5698f8f1, .ex=-18, .sgn=0},
-   {.h=0x84b9ada076cd007d, .m=0x13e55006073f76b1, .l=0x4cf4259968228f3e, .ex=-21, .sgn=0},
-   {.h=0xcca4b9046786937d, .m=0x233c1e691c127c1f, .l=0xf493e0b7a3de459a, .ex=-26, .sgn=0},
+   {.m=0x71ce6279d467aa45, .h=0x82703f8b53112eca, .l=0x19c9b28466b6fc0, .ex=-10, .sgn=0},
+   {.m=0xee590b839e751890, .h=0xb3cf74b427d53e03, .l=0xf2570b12bcb238cf, .ex=-8, .sgn=0},
+   {.m=0xf4426f84614701db, .h=0xb33c44af0d43c9e8, .l=0x979e49dc5b858442, .ex=-6, .sgn=0},
+   {.m=0xee21431cc0f29764, .h=0x8264d256f0bf4d61, .l=0xce0cc1b593ac9952, .ex=-4, .sgn=0},
+   {.m=0xef4087c49dde5229, .h=0x9d97c4947687b2ee, .l=0x742bc6e02bfb6df8, .ex=-3, .sgn=0},
+   {.m=0xf623f19ac413db23, .h=0xa0f888dc7aab949e, .l=0x854744a164f70ecd, .ex=-2, .sgn=0},
+   {.m=0x1a9f72fadafc3dfb, .h=0x8fd9c7172ab0828e, .l=0xaf96a180ea297178, .ex=-1, .sgn=0},
+   {.m=0x604a47815c8091eb, .h=0xe38168b78a51ee15, .l=0x9faaa42312e8eb30, .ex=-1, .sgn=0},
+   {.m=0xe623433c5e086402, .h=0xa164ccdbb65ee133, .l=0xcb228afd335a245f, .ex=0, .sgn=0},
+   {.m=0xd7c2adfc7c5dda9e, .h=0xced0c0cbe44fac2f, .l=0xa22b4a311cf5a5b1, .ex=0, .sgn=0},
+   {.m=0x3dca1a0f58f0d943, .h=0xf0e6660438c90371, .l=0x8a92b9de68c4488c, .ex=0, .sgn=0},
+   {.m=0x0, .h=0x8000000000000000, .l=0x0, .ex=1, .sgn=0},
+   {.m=0xb257e4bfc606967f, .h=0xf8ea68f9ad849103, .l=0x818fa2816928c4aa, .ex=0, .sgn=0},
+   {.m=0x47a33ea40a2b22e4, .h=0xddc64eeee3506234, .l=0xa6a2c129ace2470a, .ex=0, .sgn=0},
+   {.m=0x24551a9b19fa064a, .h=0xb52ddfba2d37c8e2, .l=0x3d78c68b54bc3850, .ex=0, .sgn=0},
+   {.m=0x4e97756c38785b0b, .h=0x87ac113d26b683a1, .l=0xf75f0a4506931ba8, .ex=0, .sgn=0},
+   {.m=0xe49d8f9f238f1eeb, .h=0xba065070b900f3d5, .l=0x6805d48d67f1dcd9, .ex=-1, .sgn=0},
+   {.m=0x945cfe6c83a5b828, .h=0xe902d2a4bfc22441, .l=0x519ebb457f8ccca0, .ex=-2, .sgn=0},
+   {.m=0xfaaf34c3c51dd39, .h=0x84e405c915f7769b, .l=0xa97fa0ae99382c93, .ex=-2, .sgn=0},
+   {.m=0xe0afc0b6db3dbbf5, .h=0x896da46c7e6cebb3, .l=0x61ccff6e78efff4, .ex=-3, .sgn=0},
+   {.m=0xf8e0a97902e08d47, .h=0x801a0c1a0dfefc92, .l=0x81898e0b7d8ef0bc, .ex=-4, .sgn=0},
+   {.m=0xa8cb00021849fbaf, .h=0xd59d088930df07db, .l=0xf80cc91aa0bddf89, .ex=-6, .sgn=0},
+   {.m=0xcf7c2074e0480959, .h=0x9db56a6984b77231, .l=0x3316ecaa6aa4604e, .ex=-7, .sgn=0},
+   {.m=0x9787b4265977d004, .h=0xcb7450d9d62d2e68, .l=0xba615cee00a841d7, .ex=-9, .sgn=0},
+   {.m=0x97c9139a8ced716c, .h=0xe12a52e02b64b23e, .l=0x70a176ad2b5f16d2, .ex=-11, .sgn=0},
+   {.m=0x5e04bb17eb879a5e, .h=0xd057b6d0900ed30d, .l=0x23ed135b60bea070, .ex=-13, .sgn=0},
+   {.m=0x19a687f0a4073eee, .h=0x9b1f1ca22fef7ae5, .l=0x5a9ccbc8c14578b, .ex=-15, .sgn=0},
+   {.m=0x30ea5d6fb116f775, .h=0xaeba710f053aac3b, .l=0x8a9bcfef5698f8f1, .ex=-18, .sgn=0},
+   {.m=0x13e55006073f76b1, .h=0x84b9ada076cd007d, .l=0x4cf4259968228f3e, .ex=-21, .sgn=0},
+   {.m=0x233c1e691c127c1f, .h=0xcca4b9046786937d, .l=0xf493e0b7a3de459a, .ex=-26, .sgn=0},
 };
 
 // use a type [29,29] rational approximation of atan(z) for 0 <= z <= 1
 static double __attribute__((noinline))
 atan2_accurate (double y, double x)
 {
+  CORE_MATH_STATS_COUNT (ATAN2, accurate);
   /* First check when t=y/x is small and exact and x > 0, since for
      |t| <= 0x1.d12ed0af1a27fp-27, atan(t) rounds to t (to nearest). */
   double t = y / x;
@@ -222,7 +261,7 @@ atan2_accurate (double y, double x)
       /* If |y| >= 2^-969, then since t*x has at most 106 significant bits,
          and t*x ~ y, the lower bit of t*x is >= 2^-1074, thus there is no
          underflow in __builtin_fma (t, x, -y). */
-      if (ay >= 0x6c0000000000000ul)
+      if (ay >= 0x6c0000000000000ull)
         return __builtin_fma (t, -0x1p-54, t);
       /* Now |y| < 2^-969, since x >= 2^-1074, then t <= 2^105, thus we can
          scale y and t by 2^105, which will ensure t*x-y does not underflow. */
@@ -696,8 +735,9 @@ static double atan2_fast (double *h, double *l, double y, double x)
 }
 
 // atan(y/x)
-double cr_atan2 (double y, double x)
+double __cdecl cr_atan2 (double y, double x)
 {
+  CORE_MATH_STATS_COUNT (ATAN2, calls);
   d64u64 uy = {.f = y}, ux = {.f = x};
   uint64_t ay = uy.u & MASK, ax = ux.u & MASK;
   int ey = ay >> 52, ex = ax >> 52;
@@ -766,7 +806,10 @@ double cr_atan2 (double y, double x)
     double left =  h + __builtin_fma (h, -err, l);
     double right = h + __builtin_fma (h, +err, l);
     if (left == right)
+    {
+      CORE_MATH_STATS_COUNT (ATAN2, fast);
       return left;
+    }
   }
 
   return atan2_accurate (y, x);
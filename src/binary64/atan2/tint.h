@@ -26,7 +26,15 @@ SOFTWARE.
 
 #include <stdlib.h>
 
-typedef unsigned __int128 u128;
+#include "absl/numeric/int128.h"
+
+// absl::uint128 is only needed without native 128-bit integers (MSVC), and
+// GCC does not accept it as a member of an anonymous struct
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 u128;
+#else
+typedef absl::uint128 u128;
+#endif
 
 // the following represent (-1)^sgn*(h/2^64+m/2^128+l/2^192)*2^ex
 // we have either h=m=l=0 to represent +0 or -0
@@ -46,20 +54,20 @@ typedef union {
 } tint_t;
 
 // ZERO is a tint_t representation of 0
-static const tint_t ZERO = {.h = 0, .m = 0, .l = 0, .ex = -1076, .sgn = 0};
+static const tint_t ZERO = {.m = 0, .h = 0, .l = 0, .ex = -1076, .sgn = 0};
 
 // ONE is a tint_t representation of 1
 static const tint_t ONE = {
-  .h = 0x8000000000000000, .m = 0, .l = 0, .ex = 1, .sgn = 0};
+  .m = 0, .h = 0x8000000000000000, .l = 0, .ex = 1, .sgn = 0};
 
 // PI is a tint_t representation of pi, with error < 2^-196.96
 static const tint_t PI = {
-  .h = 0xc90fdaa22168c234, .m = 0xc4c6628b80dc1cd1, .l = 0x29024e088a67cc74,
+  .m = 0xc4c6628b80dc1cd1, .h = 0xc90fdaa22168c234, .l = 0x29024e088a67cc74,
   .ex = 2, .sgn = 0};
 
 // PI2 is a tint_t representation of pi/2, with error < 2^-197.96
 static const tint_t PI2 = {
-  .h = 0xc90fdaa22168c234, .m = 0xc4c6628b80dc1cd1, .l = 0x29024e088a67cc74,
+  .m = 0xc4c6628b80dc1cd1, .h = 0xc90fdaa22168c234, .l = 0x29024e088a67cc74,
   .ex = 1, .sgn = 0};
 
 // Print a tint_t value for debugging purposes
@@ -96,25 +104,25 @@ mul_tint (tint_t *r, const tint_t *a, const tint_t *b)
   u128 rh = ah * bh, rm1 = ah * bm, rm2 = am * bh;
   u128 rl1 = ah * bl, rl2 = am * bm, rl3 = al * bh;
   uint64_t h, l, cm;
-  r->h = rh >> 64;
-  r->m = rh; // cast to low 64 bits
+  r->h = absl::Uint128High64(rh);
+  r->m = absl::Uint128Low64(rh);
   r->l = 0;
   // accumulate rm1
-  r->l = rm1; // cast to low 64 bits
-  h = rm1 >> 64;
+  r->l = absl::Uint128Low64(rm1);
+  h = absl::Uint128High64(rm1);
   r->m += h;
   r->h += r->m < h; // no overflow possible
   // accumulate rm2
-  l = rm2; // cast to low 64 bits
-  h = rm2 >> 64;
+  l = absl::Uint128Low64(rm2);
+  h = absl::Uint128High64(rm2);
   r->l += l;
   cm = r->l < l; // carry at r->m
   r->m += h;
   r->h += r->m < h; // no overflow possible
   // accumulate rl1+rl2+rl3
   rl1 = (rl1 >> 64) + (rl2 >> 64) + (rl3 >> 64);
-  l = rl1; // cast to low 64 bits
-  cm += rl1 >> 64;
+  l = absl::Uint128Low64(rl1);
+  cm += absl::Uint128High64(rl1);
   r->l += l;
   cm += r->l < l; // carry at r->m
   // accumulate cm
@@ -184,22 +192,22 @@ rshift (tint_t *a, const tint_t *b, int k)
   else if (k < 64)
   {
     a->_h = b->_h >> k;
-    a->_l = (b->_h << (64 - k)) | (b->_l >> k);
+    a->_l = absl::Uint128Low64(b->_h << (64 - k)) | (b->_l >> k);
   }
   else if (k == 64)
   {
     a->_h = b->_h >> k;
-    a->_l = b->_h;
+    a->_l = absl::Uint128Low64(b->_h);
   }
   else if (k < 128)
   {
     a->_h = b->_h >> k;
-    a->_l = b->_h >> (k - 64);
+    a->_l = absl::Uint128Low64(b->_h >> (k - 64));
   }
   else if (k < 192)
   {
     a->_h = 0;
-    a->_l = b->_h >> (k - 64);
+    a->_l = absl::Uint128Low64(b->_h >> (k - 64));
   }
   else
     a->_h = a->_l = 0;
@@ -270,10 +278,10 @@ add_tint (tint_t *r, const tint_t *a, const tint_t *b)
   if (a->sgn ^ b->sgn) { // opposite signs, it's a subtraction
     t->_l = a->_l - t->_l;
     t->_h = a->_h - t->_h - (t->_l > a->_l);
-    uint64_t th = t->_h >> 64;
+    uint64_t th = absl::Uint128High64(t->_h);
     uint64_t ex =
       th ? __builtin_clzl (th)
-      : (t->_h ? 64 + __builtin_clzl (t->_h) : 128 + __builtin_clzl (t->_l));
+      : (t->_h ? 64 + __builtin_clzl (absl::Uint128Low64(t->_h)) : 128 + __builtin_clzl (t->_l));
     if (ex <= 1 || sh == 0) {
       /* The maximal error of 1 ulp for the neglected low part of b is shifted
          by ex bits, thus contributes to < 2 ulps. And for sh=0, there is no
@@ -292,10 +300,10 @@ add_tint (tint_t *r, const tint_t *a, const tint_t *b)
       lshift (r, a, ex);
       t->_l = r->_l - t->_l;
       t->_h = r->_h - t->_h - (t->_l > r->_l);
-      th = t->_h >> 64;
+      th = absl::Uint128High64(t->_h);
       uint64_t ex1 =
         th ? __builtin_clzl (th)
-        : (t->_h ? 64 + __builtin_clzl (t->_h) : 128 + __builtin_clzl (t->_l));
+        : (t->_h ? 64 + __builtin_clzl (absl::Uint128Low64(t->_h)) : 128 + __builtin_clzl (t->_l));
       lshift (r, t, ex1);
       r->ex = a->ex - (ex + ex1);
       /* Since we shifted b left in this case, there is no neglected bit of b,
@@ -315,7 +323,7 @@ add_tint (tint_t *r, const tint_t *a, const tint_t *b)
     // up to here, the maximal error is < ulp(r) [shifted part of b]
     if (ch) { // can be at most 1
       r->ex = a->ex + 1;
-      r->_l = (r->_h << 63) | (r->_l >> 1);
+      r->_l = absl::Uint128Low64(r->_h << 63) | (r->_l >> 1);
       r->_h = ((u128) ch << 127) | (r->_h >> 1);
       /* the maximal error from the shifted part of b is now < 1/2 ulp(r),
          and in addition the low bit of r->_l that disappeared might give
@@ -334,12 +342,12 @@ static inline void tint_fromd (tint_t *a, double x)
 {
   d64u64 u = {.f = x};
   a->sgn = u.u >> 63;
-  uint64_t ax = u.u & 0x7ffffffffffffffful;
+  uint64_t ax = u.u & 0x7fffffffffffffffull;
   int64_t e = ax >> 52;
   if (__builtin_expect (e, 1)) { // normal
     // 1 has e=0x3ff
     a->ex = e - 0x3fe;
-    a->h = (1ul << 63) | (ax << 11);
+    a->h = (1ull << 63) | (ax << 11);
   }
   else { // subnormal
     // 2^-1074 has ax=1
@@ -363,11 +371,11 @@ tint_tod (const tint_t *a, uint64_t err, double y, double x)
     if (a->ex < -1074) // |a| < 2^-1075
       return (a->sgn ? -0x1p-1074 : 0x1p-1074) * 0.5;
     // 2^-1075 <= |a| < 2^-1074
-    int mid = a->h == (1ul << 63) && a->m == 0 && a->l == 0;
+    int mid = a->h == (1ull << 63) && a->m == 0 && a->l == 0;
     // if mid, |a| = 2^-1075
     return (a->sgn ? -0x1p-1074 : 0x1p-1074) * (mid ? 0.5 : 0.75);
   }
-#define MASK53 0x1ffffffffffffful
+#define MASK53 0x1fffffffffffffull
   uint64_t hh = a->h, mm = a->m, ll = a->l;
   int ex = a->ex;
   uint64_t low = hh & 0x7ff; // low 11 bits from a->h
@@ -24,6 +24,11 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/cbrt.h"
+#include "core-math/stats.h"
+
 #include <stdint.h>
 #include <fenv.h>
 
@@ -31,21 +36,60 @@ SOFTWARE.
 #include <x86intrin.h>
 #endif
 
+#include <bit>
+#include <cmath>
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __builtin_clzl
+#define __builtin_clzl(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_copysign
+#define __builtin_copysign(x, y) std::copysign(x, y)
+#endif
+#endif
 
+/* Return the rounding mode (0 for rounding to nearest, 1 downward, 2 upward,
+   3 toward zero) and save the exception flags in *flagp.  With
+   CORE_MATH_ROUNDING defined, the rounding mode is known at compile time;
+   with CORE_MATH_NO_SIDE_EFFECTS defined, the flags are not saved (nor
+   restored by set_flags). */
 static inline int get_rounding_mode (fexcept_t *flagp)
 {
-#ifdef __x86_64__
+#ifdef CORE_MATH_NO_SIDE_EFFECTS
+  (void) flagp;
+#elif defined(__x86_64__)
   *flagp = _mm_getcsr ();
-  return ((*flagp)>>13) & 3;
 #else
   fegetexceptflag (flagp, FE_ALL_EXCEPT);
+#endif
+#if defined(CORE_MATH_ROUNDING)
+  switch (CORE_MATH_ROUNDING)
+#elif defined(__x86_64__) && defined(CORE_MATH_NO_SIDE_EFFECTS)
+  return (_mm_getcsr () >> 13) & 3;
+#elif defined(__x86_64__)
+  return ((*flagp)>>13) & 3;
+#else
   switch (fegetround ())
+#endif
+#if defined(CORE_MATH_ROUNDING) || !defined(__x86_64__)
   {
   case FE_TONEAREST:
     return 0;
@@ -61,7 +105,9 @@ static inline int get_rounding_mode (fexcept_t *flagp)
 
 static inline void set_flags (const fexcept_t *flagp)
 {
-#ifdef __x86_64__
+#ifdef CORE_MATH_NO_SIDE_EFFECTS
+  (void) flagp;
+#elif defined(__x86_64__)
   _mm_setcsr (*flagp);
 #else
   fesetexceptflag (flagp, FE_ALL_EXCEPT);
@@ -70,9 +116,10 @@ static inline void set_flags (const fexcept_t *flagp)
 
 typedef union {double f; uint64_t u;} b64u64_u;
 
-double
+double __cdecl
 cr_cbrt (double x)
 {
+  CORE_MATH_STATS_COUNT(CBRT, calls);
   static const double escale[3] = {1.0, 0x1.428a2f98d728bp+0/* 2^(1/3) */, 0x1.965fea53d6e3dp+0/* 2^(2/3) */};
   /* the polynomial c0+c1*x+c2*x^2+c3*x^3 approximates x^(1/3) on [1,2]
      with maximal error < 9.2e-5 (attained at x=2) */
@@ -84,20 +131,20 @@ cr_cbrt (double x)
   unsigned int rm = get_rounding_mode (&flag);
   /* rm=0 for rounding to nearest, and other values for directed roundings */
   b64u64_u cvt0 = {.f = x};
-  uint64_t hx = cvt0.u, mant = hx&((~0ul)>>12), sign = hx>>63;
+  uint64_t hx = cvt0.u, mant = hx&((~0ull)>>12), sign = hx>>63;
   unsigned e = (hx>>52)&0x7ff;
   if(__builtin_expect(((e+1)&0x7ff)<2, 0)){
-    uint64_t ix = hx&((~0ul)>>1);
+    uint64_t ix = hx&((~0ull)>>1);
     if(e==0x7ff||ix==0) return x + x; /* 0, inf, nan: we return x + x instead of simply x,
                                          to that for x a signaling NaN, it correctly triggers
                                          the invalid exception. */
     int nz = __builtin_clzl(ix) - 11;  /* subnormal */
     mant <<= nz;
-    mant &= (~(0ul))>>12;
+    mant &= (~(0ull))>>12;
     e -= nz - 1;
   }
   e += 3072;
-  b64u64_u cvt1 = {.u = mant|(0x3fful<<52)}, cvt5 = {.u = cvt1.u};
+  b64u64_u cvt1 = {.u = mant|(0x3ffull<<52)}, cvt5 = {.u = cvt1.u};
   unsigned et = e/3, it = e%3;
   /* 2^(3k+it) <= x < 2^(3k+it+1), with 0 <= it <= 3 */
   cvt5.u += (int64_t)it<<52;
@@ -142,6 +189,7 @@ cr_cbrt (double x)
   double ady0 = __builtin_fabs(ady - off[rm]);
   double ady1 = __builtin_fabs(ady - (0x1p-52+off[rm]));
   if(__builtin_expect(ady0<0x1p-75 || ady1<0x1p-75, 0)){
+    CORE_MATH_STATS_COUNT(CBRT, accurate);
     y2 = y1*y1; y2l = __builtin_fma(y1,y1,-y2);
     y3 = y2*y1; y3l = __builtin_fma(y1,y2,-y3) + y1*y2l;
     h = ((y3 - zz) + y3l)*rr;
@@ -154,10 +202,14 @@ cr_cbrt (double x)
     ady1 = __builtin_fabs(ady - (0x1p-52+off[rm]));
     if(__builtin_expect(ady0<0x1p-98 || ady1<0x1p-98, 0)){
       double azz = __builtin_fabs(zz);
-      if(azz == 0x1.9b78223aa307cp+1) // ~ 0x1.79d15d0e8d59b80000000000000ffc3dp+0
+      if(azz == 0x1.9b78223aa307cp+1){ // ~ 0x1.79d15d0e8d59b80000000000000ffc3dp+0
+	CORE_MATH_STATS_COUNT(CBRT, database);
 	y1 = __builtin_copysign(0x1.79d15d0e8d59cp+0, zz);
-      if(azz == 0x1.a202bfc89ddffp+2) // ~ 0x1.de87aa837820e80000000000001c0f08p+0
+      }
+      if(azz == 0x1.a202bfc89ddffp+2){ // ~ 0x1.de87aa837820e80000000000001c0f08p+0
+	CORE_MATH_STATS_COUNT(CBRT, database);
 	y1 = __builtin_copysign(0x1.de87aa837820fp+0, zz);
+      }
       if(rm>0){
 	static const double wlist[][2] = {
 	  {0x1.3a9ccd7f022dbp+0, 0x1.1236160ba9b93p+0},// ~ 0x1.1236160ba9b930000000000001e7e8fap+0
@@ -169,20 +221,23 @@ cr_cbrt (double x)
 	  {0x1.ac8538a031cbdp+2, 0x1.e281d87098de8p+0},// ~ 0x1.e281d87098de80000000000000ee9314p+0
 	};
 	for(int i=0;i<7;i++){
-	  if(azz == wlist[i][0])
+	  if(azz == wlist[i][0]){
+	    CORE_MATH_STATS_COUNT(CBRT, database);
 	    y1 = __builtin_copysign(wlist[i][1] + ((rm+sign == 2) ? 0x1p-52 : 0), zz);
+	  }
 	}
       }
     }
-  }
+  } else
+    CORE_MATH_STATS_COUNT(CBRT, fast);
   b64u64_u cvt3 = {.f = y1};
-  cvt3.u += (long)(et - 342 - 1023)<<52;
+  cvt3.u += (uint64_t)(et - 342 - 1023)<<52;
   int64_t m0 = cvt3.u<<30, m1 = m0>>63;
-  if(__builtin_expect((uint64_t)(m0^m1)<=(1ul<<30),0)){
+  if(__builtin_expect((uint64_t)(m0^m1)<=(1ull<<30),0)){
     b64u64_u cvt4 = {.f = y1};
-    cvt4.u = (cvt4.u + (1ul<<15))&0xffffffffffff0000ul;
+    cvt4.u = (cvt4.u + (1ull<<15))&0xffffffffffff0000ull;
     if( __builtin_fabs((cvt4.f - y1) - dy) < 0x1p-60 || __builtin_fabs(zz) == 1.0 ){
-      cvt3.u = (cvt3.u + (1ul<<15))&0xffffffffffff0000ul;
+      cvt3.u = (cvt3.u + (1ull<<15))&0xffffffffffff0000ull;
       set_flags (&flag);
     }
   }
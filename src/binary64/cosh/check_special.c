@@ -33,6 +33,7 @@ SOFTWARE.
 #include <sys/types.h>
 #include <unistd.h>
 #include <omp.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_init (void);
 int ref_fesetround (int);
@@ -139,15 +140,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
 
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     do x = get_random (); while (fabs (x) >= 0x1.633ce8fb9f87ep+9);
     check_random (x);
   }
+  check_loop_end ();
 
   return 0;
 }
@@ -32,6 +32,7 @@ SOFTWARE.
 #include <math.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_init (void);
 int ref_fesetround (int);
@@ -137,14 +138,17 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
   
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
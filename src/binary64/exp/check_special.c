@@ -31,6 +31,7 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_fesetround (int);
 void ref_init (void);
@@ -157,25 +158,45 @@ main (int argc, char *argv[])
   // first check values around x0
 #define K 1000000
   printf ("Checking results around log(2^-1075)\n");
-#pragma omp parallel for
+  check_loop_begin (2 * K, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n0 - K; n < n0 + K; n++)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -43));
+  }
+  check_loop_end ();
   // then check values around x2
   printf ("Checking results around log(2^-1074)\n");
-#pragma omp parallel for
+  check_loop_begin (2 * K, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n2 - K; n < n2 + K; n++)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -43));
+  }
+  check_loop_end ();
   // then check values around x1
   printf ("Checking results around log(2^-1022)\n");
-#pragma omp parallel for
+  check_loop_begin (2 * K, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n1 - K; n < n1 + K; n++)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -43));
+  }
+  check_loop_end ();
   printf ("Checking results in subnormal range\n");
 #define SKIP 20000
   n0 += getpid () % SKIP;
-#pragma omp parallel for
+  check_loop_begin ((n1 - n0 + SKIP - 1) / SKIP, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n0; n < n1; n += SKIP)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -43));
+  }
+  check_loop_end ();
 
   printf ("Checking random values\n");
 #define N 1000000000UL /* total number of tests */
@@ -183,15 +204,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
 
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
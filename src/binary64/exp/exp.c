@@ -24,17 +24,50 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/exp.h"
+#include "core-math/stats.h"
+
 #include <stdint.h>
+#include <fenv.h>
 #if defined(__x86_64__)
 #include <x86intrin.h>
 #endif
 
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __attribute__
+#define __attribute__(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_roundeven
+// roundsd with imm8 = 8: round to nearest-even, independently of the
+// current rounding mode, and do not raise the inexact exception.
+#define __builtin_roundeven(x) \
+  _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(x), \
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+#endif
+#endif
 
 typedef int64_t i64;
 typedef uint64_t u64;
@@ -90,7 +123,7 @@ static inline double as_ldexp(double x, i64 i){
 
 static inline double as_todenormal(double x){
 #ifdef __x86_64__
-    __m128i sb; sb[0] = ~0ul>>12;
+    __m128i sb; sb[0] = ~0ull>>12;
 #if defined(__clang__)
     __m128d r = _mm_set_sd(x);
 #else
@@ -100,7 +133,7 @@ static inline double as_todenormal(double x){
     return r[0];
 #else
     b64u64_u ix = {.f = x};
-    ix.u &= ~0ul>>12;
+    ix.u &= ~0ull>>12;
     return ix.f;
 #endif
 }
@@ -129,9 +162,10 @@ static double __attribute__((noinline)) as_exp_database(double x, double f){
     if (c[m].u < ix.u){
       a = m + 1;
     } else if (__builtin_expect(c[m].u == ix.u, 0)) {
-      static const u64 s2[2] = {0x57f5fe2e5bde4075ul, 0x3c1f16b8edul};
+      CORE_MATH_STATS_COUNT(EXP, database);
+      static const u64 s2[2] = {0x57f5fe2e5bde4075ull, 0x3c1f16b8edull};
       const u64 s = 333811522313371;
-      b64u64_u jf = {.f = f}, dr = {.u = ((s>>m)<<63)|0x3c90000000000000ul};
+      b64u64_u jf = {.f = f}, dr = {.u = ((s>>m)<<63)|0x3c90000000000000ull};
       u64 t = (s2[m>>5]>>((m<<1)&63))&3;
       for(i64 k = -1; k<=1; k++){
 	b64u64_u r = {.u = jf.u + k};
@@ -215,7 +249,8 @@ static const double t1[][2] = {
   {0x1.4a47a505b3a46p-54, 0x1.02b338c811703p+0}, {0x1.e47120223468p-54, 0x1.02be6e199c811p+0},
 };
 
-static double __attribute__((noinline)) as_exp_accurate(double x){
+double __attribute__((noinline)) __cdecl cr_exp_accurate(double x){
+  CORE_MATH_STATS_COUNT(EXP, accurate);
   static const double ch[][2] =
     {{0x1p+0, 0}, {0x1p-1, 0x1.712f72ecec2cfp-99}, {0x1.5555555555555p-3, 0x1.5555555554d07p-57},
      {0x1.5555555555555p-5, 0x1.55194d28275dap-59}, {0x1.1111111111111p-7, 0x1.12faa0e1c0f7bp-63},
@@ -234,7 +269,7 @@ static double __attribute__((noinline)) as_exp_accurate(double x){
   double dxh = dx + dxl; dxl = (dx - dxh) + dxl + dxll;
   double fl, fh = opolydd(dxh,dxl, 7,ch, &fl);
   fh = muldd(dxh,dxl, fh,fl, &fl);
-  if(__builtin_expect(ix.u>0xc086232bdd7abcd2ul, 0)){
+  if(__builtin_expect(ix.u>0xc086232bdd7abcd2ull, 0)){
     ix.u = (1-ie)<<52;
     fh = muldd(fh,fl, th,tl, &fl);
     fh = fastsum(th,tl, fh,fl, &fl);
@@ -248,7 +283,7 @@ static double __attribute__((noinline)) as_exp_accurate(double x){
       fh = fasttwosum(th,fh, &e);
       fl = fasttwosum(e, fl, &e);
       ix.f = fl;
-      if((ix.u&(~0ul>>12))==0) {
+      if((ix.u&(~0ull>>12))==0) {
 	b64u64_u v = {.f = e};
 	i64 d = ((((i64)ix.u>>63)^((i64)v.u>>63))<<1) + 1;
 	ix.u += d;
@@ -260,29 +295,34 @@ static double __attribute__((noinline)) as_exp_accurate(double x){
     }
     fh = fasttwosum(fh,fl, &fl);
     ix.f = fl;
-    u64 d = (ix.u + 2)&(~0ul>>12);
+    u64 d = (ix.u + 2)&(~0ull>>12);
     if(__builtin_expect(d<=2, 0)) fh = as_exp_database(x, fh);
     fh = as_ldexp(fh, ie);
   }
   return fh;
 }
 
-double cr_exp(double x){
+double __cdecl cr_exp(double x){
+  CORE_MATH_STATS_COUNT(EXP, calls);
   b64u64_u ix = {.f = x};
-  u64 aix = ix.u & (~0ul>>1);
-  if(__builtin_expect(aix>=0x40862e42fefa39f0ul, 0)){
-    if(aix>0x7ff0000000000000ul) return x;
-    if(aix==0x7ff0000000000000ul){
+  u64 aix = ix.u & (~0ull>>1);
+  if(__builtin_expect(aix>=0x40862e42fefa39f0ull, 0)){
+    if(aix>0x7ff0000000000000ull) return x;
+    if(aix==0x7ff0000000000000ull){
       if(ix.u>>63)
 	return 0.0;
       else
 	return x;
     }
     if(!(ix.u>>63)){
+#ifdef CORE_MATH_NO_SIDE_EFFECTS
+      double z = 0x1p1023;
+#else
       volatile double z = 0x1p1023;
+#endif
       return z*z;
     }
-    if(aix>=0x40874910d52d3052ul) return 0x1.5p-1022 * 0x1p-55;
+    if(aix>=0x40874910d52d3052ull) return 0x1.5p-1022 * 0x1p-55;
   }
   const double s = 0x1.71547652b82fep+12;
   double t = __builtin_roundeven(x*s);
@@ -296,18 +336,19 @@ double cr_exp(double x){
   double p = (ch[0] + dx*ch[1]) + dx2*(ch[2] + dx*ch[3]);
   double fh = th, tx = th*dx, fl = tl + tx*p;
   double eps = 1.64e-19;
-  if(__builtin_expect(ix.u>0xc086232bdd7abcd2ul, 0)){
+  if(__builtin_expect(ix.u>0xc086232bdd7abcd2ull, 0)){
     ix.u = (1-ie)<<52;
     double e;
     fh = fasttwosum(ix.f, fh, &e);
     fl += e;
     double ub = fh + (fl + eps), lb = fh + (fl - eps);
-    if(__builtin_expect( ub != lb, 0)) return as_exp_accurate(x);
+    if(__builtin_expect( ub != lb, 0)) return cr_exp_accurate(x);
     fh = as_todenormal(lb);
   } else {
     double ub = fh + (fl + eps), lb = fh + (fl - eps);
-    if(__builtin_expect( ub != lb, 0)) return as_exp_accurate(x);
+    if(__builtin_expect( ub != lb, 0)) return cr_exp_accurate(x);
     fh = as_ldexp(lb, ie);
   }
+  CORE_MATH_STATS_COUNT(EXP, fast);
   return fh;
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_fesetround (int);
 void ref_init (void);
@@ -169,9 +170,14 @@ main (int argc, char *argv[])
   int64_t n1 = ldexp (x1, 44); /* n1 = -5412282753821249 */
 #define SKIP 20000
   n0 += getpid () % SKIP;
-#pragma omp parallel for
+  check_loop_begin ((n1 - n0 + SKIP - 1) / SKIP, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n0; n < n1; n += SKIP)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -44));
+  }
+  check_loop_end ();
 
   printf ("Checking random values\n");
 #define N 1000000000UL /* total number of tests */
@@ -179,15 +185,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
 
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_fesetround (int);
 void ref_init (void);
@@ -156,18 +157,28 @@ main (int argc, char *argv[])
   int64_t n1 = ldexp (x1, 42); /* n1 = -4503599627370496 */
 #define SKIP 20000
   n0 += getpid () % SKIP;
-#pragma omp parallel for
+  check_loop_begin ((n1 - n0 + SKIP - 1) / SKIP, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n0; n < n1; n += SKIP)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -42));
+  }
+  check_loop_end ();
   /* x2 is the smallest x such that 2^-1022 <= RN(exp2(x)) */
   double x2 = -1022;
   /* in the [x1,x2) range, floating-point numbers have an integer part
      of 10 bits, thus we multiply by 2^43 to get integers */
   n1 = ldexp (x1, 43); /* n1 = -9007199254740992, twice as large as above */
   int64_t n2 = ldexp (x2, 43); /* n2 = -8989607068696576 */
-#pragma omp parallel for
+  check_loop_begin ((n2 - n1 + SKIP - 1) / SKIP, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n1; n < n2; n += SKIP)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -43));
+  }
+  check_loop_end ();
 
   printf ("Checking random values\n");
 #define N 1000000000UL /* total number of tests */
@@ -175,15 +186,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
 
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
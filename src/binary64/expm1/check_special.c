@@ -32,6 +32,7 @@ SOFTWARE.
 #include <math.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_init (void);
 int ref_fesetround (int);
@@ -137,14 +138,17 @@ main (int argc, char *argv[])
   int64_t n1 = 0x10000000000000ul; // 2^-1022/2^-1074
 #define SKIP 500000
   n0 += getpid () % SKIP;
-#pragma omp parallel for
+  check_loop_begin ((n1 - n0 + SKIP - 1) / SKIP, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (int64_t n = n0; n < n1; n += SKIP)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     check (ldexp ((double) n, -1074));
     check (ldexp ((double) -n, -1074));
   }
+  check_loop_end ();
 
   printf ("Checking random values\n");
 #define N 1000000000UL /* total number of tests */
@@ -152,15 +156,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
   
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <omp.h>
 #include <unistd.h>
 #include <math.h>
+#include "../../generic/support/check_loop.h"
 
 void doloop (int, int);
 extern double cr_hypot (double, double);
@@ -314,8 +315,11 @@ check_triples_subnormal (void)
     s0 ++; // ensures s0 is even and >= 2
 
   // type I: r is odd
-#pragma omp parallel for
+  check_loop_begin ((0x4000000 - r0) / (2 * STEP) + 1, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t r = r0; r <= 0x4000000; r += 2 * STEP)
+  {
+    check_loop_step ();
     for (uint64_t s = s0; s < r; s += 2 * STEP)
     {
       if (gcd (r, s) == 1)
@@ -336,10 +340,15 @@ check_triples_subnormal (void)
         }
       }
     }
+  }
+  check_loop_end ();
 
   // type II: r is even
-#pragma omp parallel for
+  check_loop_begin ((0x4000000 - (r0 + 1)) / (2 * STEP) + 1, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t r = r0+1; r <= 0x4000000; r += 2 * STEP)
+  {
+    check_loop_step ();
     for (uint64_t s = s0-1; s < r; s += 2 * STEP)
     {
       if (gcd (r, s) == 1)
@@ -360,6 +369,8 @@ check_triples_subnormal (void)
         }
       }
     }
+  }
+  check_loop_end ();
 }
 
 int
@@ -24,19 +24,63 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/hypot.h"
+#include "core-math/stats.h"
+
 #include <stdint.h>
+#include <fenv.h>
 #include <errno.h>
 
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "absl/numeric/int128.h"
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __attribute__
+#define __attribute__(x)
+#endif
+#ifndef __builtin_clzll
+#define __builtin_clzll(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_fmax
+#define __builtin_fmax(x, y) std::fmax(x, y)
+#endif
+#ifndef __builtin_fmin
+#define __builtin_fmin(x, y) std::fmin(x, y)
+#endif
+#ifndef __builtin_inf
+#define __builtin_inf() std::numeric_limits<double>::infinity()
+#endif
+#ifndef __builtin_sqrt
+#define __builtin_sqrt(x) std::sqrt(x)
+#endif
+#endif
 
 typedef uint64_t u64;
 typedef int64_t i64;
-typedef unsigned __int128 u128;
+typedef absl::uint128 u128;
 typedef union {double f; u64 u;} b64u64_u;
 
 static inline double fasttwosum(double x, double y, double *e){
@@ -84,15 +128,16 @@ static double __attribute__((noinline)) as_hypot_denorm(u64 a, u64 b){
    also fits in a 128-bit integer), compared and adjusted if necessary using
    the exact value of x^2+y^2. */
 static double  __attribute__((noinline)) as_hypot_hard(double x, double y){
+  CORE_MATH_STATS_COUNT(HYPOT, accurate);
   double op = 1.0 + 0x1p-54, om = 1.0 - 0x1p-54;
   b64u64_u xi = {.f = x}, yi = {.f = y};
-  u64 bm = (xi.u&(~0ul>>12))|1l<<52;
-  u64 lm = (yi.u&(~0ul>>12))|1l<<52;
+  u64 bm = (xi.u&(~0ull>>12))|1ll<<52;
+  u64 lm = (yi.u&(~0ull>>12))|1ll<<52;
   int be = xi.u>>52;
   int le = yi.u>>52;
   b64u64_u ri = {.f = __builtin_sqrt(x*x + y*y)};
   const int bs = 3;
-  u64 rm = (ri.u&(~0ul>>12))|1l<<52; int re = (ri.u>>52)-0x3ff;
+  u64 rm = (ri.u&(~0ull>>12))|1ll<<52; int re = (ri.u>>52)-0x3ff;
   bm <<= bs;
   u64 m2 = bm*bm;
   int de = be-le;
@@ -103,7 +148,7 @@ static double  __attribute__((noinline)) as_hypot_hard(double x, double y){
   } else {
     u128 lm2 = (u128)lm*lm;
     ls *= 2;
-    m2 += lm2 >> -ls;
+    m2 += absl::Uint128Low64(lm2 >> -ls);
     m2 |= !!(lm2 << (128 + ls));
   }
   int k = bs+re, sr = 2*k+1;
@@ -140,15 +185,23 @@ static double  __attribute__((noinline)) as_hypot_hard(double x, double y){
 }
 
 static double __attribute__((noinline)) as_hypot_overflow(){
+#ifdef CORE_MATH_NO_SIDE_EFFECTS
+  /* the same value (+Inf or DBL_MAX depending on the rounding mode), without
+     forcing the operation to raise overflow nor setting errno */
+  double z = 0x1.fffffffffffffp1023;
+  return z + z;
+#else
   volatile double z = 0x1.fffffffffffffp1023;
   double f = z + z;
   if(f>z) errno = ERANGE;
   return f;
+#endif
 }
 
-double cr_hypot(double x, double y){
+double __cdecl cr_hypot(double x, double y){
+  CORE_MATH_STATS_COUNT(HYPOT, calls);
   b64u64_u xi = {.f = x}, yi = {.f = y};
-  u64 emsk = 0x7ffl<<52, ex = xi.u&emsk, ey = yi.u&emsk;
+  u64 emsk = 0x7ffll<<52, ex = xi.u&emsk, ey = yi.u&emsk;
   /* emsk corresponds to the upper bits of NaN and Inf (apart the sign bit) */
   x = __builtin_fabs(x), y = __builtin_fabs(y);
   if(__builtin_expect(ex==emsk||ey==emsk, 0)){
@@ -165,7 +218,7 @@ double cr_hypot(double x, double y){
   double u = __builtin_fmax(x,y), v = __builtin_fmin(x,y);
   b64u64_u xd = {.f = u}, yd = {.f = v};
   u64 de = xd.u - yd.u;
-  if(__builtin_expect(de>(27l<<52),0)) return __builtin_fma(0x1p-27, v, u);
+  if(__builtin_expect(de>(27ll<<52),0)) return __builtin_fma(0x1p-27, v, u);
   ey = yd.u;
   if(__builtin_expect(!(ey>>52),0)){
     ex = xd.u;
@@ -175,12 +228,12 @@ double cr_hypot(double x, double y){
     }
     int nz = __builtin_clzll(ey);
     ey <<= nz-11;
-    ey &= ~0ul>>12;
-    ey -= (nz-12l)<<52;
+    ey &= ~0ull>>12;
+    ey -= (nz-12ll)<<52;
     b64u64_u t = {.u = ey};
     yd.f = t.f;
   }
-  i64 off = (0x3ffl<<52) - (xd.u & emsk);
+  i64 off = (0x3ffll<<52) - (xd.u & emsk);
   xd.u += off;
   yd.u += off;
   x = xd.f;
@@ -194,12 +247,14 @@ double cr_hypot(double x, double y){
   b64u64_u thd = {.f = th}, tld = {.f = __builtin_fabs(tl)};
   ex = thd.u;
   ey = tld.u;
-  ex &= 0x7ffl<<52;
-  u64 aidr = ey + (0x3fel<<52) - ex;
+  ex &= 0x7ffll<<52;
+  u64 aidr = ey + (0x3fell<<52) - ex;
   u64 mid = (aidr - 0x3c90000000000000 + 16)>>5;
-  if(__builtin_expect( mid==0 || aidr<0x39b0000000000000ul || aidr>0x3c9fffffffffff80ul, 0)) 
+  if(__builtin_expect( mid==0 || aidr<0x39b0000000000000ull || aidr>0x3c9fffffffffff80ull, 0)) 
     thd.f = as_hypot_hard(x,y);
+  else
+    CORE_MATH_STATS_COUNT(HYPOT, fast);
   thd.u -= off;
-  if(__builtin_expect(thd.u>=(0x7fful<<52), 0)) return as_hypot_overflow();
+  if(__builtin_expect(thd.u>=(0x7ffull<<52), 0)) return as_hypot_overflow();
   return thd.f;
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <fenv.h>
 #include <math.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_fesetround (int);
 void ref_init (void);
@@ -148,14 +149,24 @@ main (int argc, char *argv[])
 #define N 0x100000
   /* check 2^20 values below 1 */
   printf ("Checking values just below 1\n");
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = n1 - N; n < n1; n++)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -53));
+  }
+  check_loop_end ();
   /* check 2^20 values above 1 */
   printf ("Checking values just above 1\n");
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = n1; n < n1 + 2 * N; n+=2)
+  {
+    check_loop_step ();
     check (ldexp ((double) n, -53));
+  }
+  check_loop_end ();
 
 #undef N
   printf ("Checking random values\n");
@@ -164,15 +175,18 @@ main (int argc, char *argv[])
   unsigned int seed = getpid ();
   srand (seed);
 
-#pragma omp parallel for
+  check_loop_begin (N, "check_special");
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
   for (uint64_t n = 0; n < N; n++)
   {
+    check_loop_step ();
     ref_init ();
     ref_fesetround (rnd);
     double x;
     x = get_random ();
     check (x);
   }
+  check_loop_end ();
 
   return 0;
 }
@@ -38,6 +38,8 @@ SOFTWARE.
 #include <stdint.h>
 #include <stdio.h>
 
+#include "absl/numeric/int128.h"
+
 /*
   Type and structure definitions
 */
@@ -45,7 +47,7 @@ SOFTWARE.
 #ifndef UINT128_T
 #define UINT128_T
 
-typedef unsigned __int128 u128;
+typedef absl::uint128 u128;
 
 typedef union {
   u128 r;
@@ -155,8 +157,8 @@ static inline void add_dint(dint64_t *r, const dint64_t *a, const dint64_t *b) {
 
   // From now on, |A| > |B|
 
-  uint128_t A = {.h = a->hi, .l = a->lo};
-  uint128_t B = {.h = b->hi, .l = b->lo};
+  uint128_t A = {.r = absl::MakeUint128(a->hi, a->lo)};
+  uint128_t B = {.r = absl::MakeUint128(b->hi, b->lo)};
   int64_t m_ex = a->ex;
 
   if (a->ex > b->ex) {
@@ -25,15 +25,39 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/log.h"
+#include "core-math/stats.h"
+
 #include <stdint.h>
-#include "dint.h"
+#include <fenv.h>
+
+#include <bit>
+#include <cmath>
 
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __builtin_clzl
+#define __builtin_clzl(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#endif
+
+#include "dint.h"
 
 typedef union { double f; uint64_t u; } d64u64;
 
@@ -629,9 +653,10 @@ static void log_2 (dint64_t *r, dint64_t *x);
 static inline double dint_tod (dint64_t *a);
 
 /* accurate path, using Tom Hubrecht's code below */
-static double
+double __cdecl
 cr_log_accurate (double x)
 {
+  CORE_MATH_STATS_COUNT (LOG, accurate);
   dint64_t X, Y;
 
   if (x == 1.0)
@@ -643,9 +668,10 @@ cr_log_accurate (double x)
   return dint_tod (&Y);
 }
 
-double
+double __cdecl
 cr_log (double x)
 {
+  CORE_MATH_STATS_COUNT (LOG, calls);
   d64u64 v = {.f = x};
   int e = (v.u >> 52) - 0x3ff;
   if (e >= 0x400 || e == -0x3ff) /* x <= 0 or NaN/Inf or subnormal */
@@ -668,7 +694,7 @@ cr_log (double x)
   }
   /* now x > 0 */
   /* normalize v in [1,2) */
-  v.u = (0x3fful << 52) | (v.u & 0xfffffffffffff);
+  v.u = (0x3ffull << 52) | (v.u & 0xfffffffffffff);
   /* now x = m*2^e with 1 <= m < 2 (m = v.f) and -1074 <= e <= 1023 */
   double h, l;
   cr_log_fast (&h, &l, e, v);
@@ -681,7 +707,10 @@ cr_log (double x)
 
   double left = h + (l - err), right = h + (l + err);
   if (left == right)
+  {
+    CORE_MATH_STATS_COUNT (LOG, fast);
     return left;
+  }
   /* the probability of failure of the fast path is about 2^-11.5 */
   return cr_log_accurate (x);
 }
@@ -772,7 +801,7 @@ static inline void fast_extract(int64_t *e, uint64_t *m, double x) {
   f64_u _x = {.f = x};
 
   *e = (_x.u >> 52) & 0x7ff;
-  *m = (_x.u & (~0ul >> 12)) + (*e ? (1ul << 52) : 0);
+  *m = (_x.u & (~0ull >> 12)) + (*e ? (1ull << 52) : 0);
   *e = *e - 0x3ff;
 }
 
@@ -792,7 +821,7 @@ static inline void dint_fromd(dint64_t *a, double b) {
 // assuming the input is not in the subnormal range
 static inline double dint_tod(dint64_t *a) {
 
-  f64_u r = {.u = (a->hi >> 11) | (0x3ffl << 52)};
+  f64_u r = {.u = (a->hi >> 11) | (0x3ffll << 52)};
   /* r contains the upper 53 bits of a->hi, 1 <= r < 2 */
 
   double rd = 0.0;
@@ -32,6 +32,7 @@ SOFTWARE.
 #include <math.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include "../../generic/support/check_loop.h"
 
 int ref_init (void);
 int ref_fesetround (int);
@@ -134,6 +135,7 @@ main (int argc, char *argv[])
   
   double buf[BUF_SIZE];
   uint64_t N = K / BUF_SIZE;
+  check_loop_begin (N * BUF_SIZE, "check_special");
   for (uint64_t n = 0; n < N; n++)
   {
     /* warning: lrand48 is not thread-safe, thus we put it outside
@@ -145,10 +147,14 @@ main (int argc, char *argv[])
       double x = asfloat64 (j);
       buf[i] = (x >= 0) ? x : -x;
     }
-#pragma omp parallel for
+#pragma omp parallel for schedule(dynamic,check_loop_chunk)
     for (int i = 0; i < BUF_SIZE; i++)
+    {
+      check_loop_step ();
       check (buf[i]);
+    }
   }
+  check_loop_end ();
 
   return 0;
 }
@@ -54,17 +54,76 @@ SOFTWARE.
    This code corresponds to reference [5].       
 */
 
-#include "pow.h"
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/pow.h"
+#include "core-math/stats.h"
+
 #include <stdio.h>
 #include <stdint.h>
+#include <fenv.h>
 #include <stdlib.h>
 
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+
 // Warning: clang also defines __GNUC__
 #if defined(__GNUC__) && !defined(__clang__)
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #endif
 
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
 #pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __builtin_clzl
+#define __builtin_clzl(x) std::countl_zero((uint64_t) (x))
+#endif
+#ifndef __builtin_ctzl
+#define __builtin_ctzl(x) std::countr_zero((uint64_t) (x))
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_isnan
+#define __builtin_isnan(x) std::isnan(x)
+#endif
+#ifndef __builtin_roundeven
+// roundsd with imm8 = 8: round to nearest-even, independently of the
+// current rounding mode, and do not raise the inexact exception.
+#define __builtin_roundeven(x) \
+  _mm_cvtsd_f64(_mm_round_sd(_mm_setzero_pd(), _mm_set_sd(x), \
+                             _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC))
+#endif
+#ifndef __builtin_mul_overflow
+// Only used below with an unsigned first operand and a nonnegative second one.
+template <typename T>
+static inline bool __builtin_mul_overflow(uint64_t a, T b, T *r) {
+  uint64_t h, l = _umul128(a, (uint64_t) b, &h);
+  *r = (T) l;
+  return h != 0 || l > (uint64_t) std::numeric_limits<T>::max();
+}
+#endif
+#endif
+
+#include "pow.h"
 
 #ifndef POW_ITERATION
 #define POW_ITERATION 15
@@ -75,6 +134,18 @@ SOFTWARE.
 #define ENABLE_EXACT (POW_ITERATION & 0x4)
 #define ENABLE_ZIV3 (POW_ITERATION & 0x8)
 
+/* Raise the exceptions e, unless compiled with CORE_MATH_NO_SIDE_EFFECTS
+   (the returned value does not depend on it). */
+static inline void
+raise_exceptions (int e)
+{
+#ifdef CORE_MATH_NO_SIDE_EFFECTS
+  (void) e;
+#else
+  feraiseexcept (e);
+#endif
+}
+
 /***************** polynomial approximations of exp(z) ***********************/
 
 /* Given z such that |z| < 2^-12.905,
@@ -548,21 +619,21 @@ p_3 (qint64_t *r, qint64_t *z) {
 */
 static inline int log_1 (double *h, double *l, double x) {
   f64_u _x = {.f = x};
-  uint64_t _m = _x.u & (~0ul >> 12);
+  uint64_t _m = _x.u & (~0ull >> 12);
   int64_t _e = (_x.u >> 52) & 0x7ff;
 
   f64_u _t;
 
   if (__builtin_expect(_e,1)) {
-    _t.u = _m | (0x3ffl << 52);
-    _m += 1ul << 52;
+    _t.u = _m | (0x3ffll << 52);
+    _m += 1ull << 52;
     _e -= 0x3ff;
   } else { /* x is a subnormal double  */
     uint32_t k = __builtin_clzl (_m) - 11;
 
-    _e = -0x3fel - k;
+    _e = -0x3fell - k;
     _m <<= k;
-    _t.u = _m | (0x3ffl << 52);
+    _t.u = _m | (0x3ffll << 52);
   }
 
   /* now |x| = 2^_e*_t = 2^(_e-52)*m with 1 <= _t < 2,
@@ -1216,7 +1287,7 @@ exact_pow (double *r, double x, double y, const dint64_t *z) {
 
   if (F < 0) { /* case (b) */
     /* check that E is divisible by 2^-F */
-    if ((E & (~0ul >> (64 + F))))
+    if ((E & (~0ull >> (64 + F))))
       return 0;
 
     int64_t G, g = (E >> -F) * n;
@@ -1231,7 +1302,7 @@ exact_pow (double *r, double x, double y, const dint64_t *z) {
        the rounding test from the 2nd phase did succeed.
     */
     int cnt = __builtin_clzl (k);
-    dint64_t d = { .hi = k << cnt, .lo = 0, .ex = G + 63 - cnt, .sgn = 1 - z->sgn };
+    dint64_t d = { .lo = 0, .hi = (uint64_t) (k << cnt), .ex = G + 63 - cnt, .sgn = 1 - z->sgn };
     add_dint (&d, z, &d); /* exact by Sterbenz theorem */
     /* multiply d by 2^116 */
     d.ex += 116;
@@ -1245,7 +1316,7 @@ exact_pow (double *r, double x, double y, const dint64_t *z) {
     /* The following code is used when k is a multiple of a power of 2,
        to reduce to 2^X*r with odd r. It checks whether k is an odd number
        multiplied by 2^(g-G). */
-    if (((k & ~(~1ul << (g - G))) == (1ul << (g - G)))) {
+    if (((k & ~(~1ull << (g - G))) == (1ull << (g - G)))) {
       *r = (double)((k >> (g - G)) * _s);
       pow2(r, g);
 
@@ -1285,8 +1356,160 @@ exact_pow (double *r, double x, double y, const dint64_t *z) {
   return 1;
 }
 
+/* Second and third phases of cr_pow: return s * x^y for x > 0, where Y and qY
+   hold y exactly (their sign being that of y), and y is either the double
+   argument of cr_pow or (for cr_pown) the nearest double to the integer
+   exponent.  exact_pow() is only called when exact is non-zero, i.e., when y
+   is exactly the exponent.  The error analysis assumes |y*log(x)| < 744.45,
+   which holds whenever the first phase failed. */
+static double
+pow_accurate (double x, double y, const dint64_t *Y, const qint64_t *qY,
+              double s, int exact)
+{
+  uint64_t rd; // used in the 2nd and 3rd phases
+
+// Second iteration of rounding
+#if ENABLE_ZIV2 > 0
+  dint64_t X;
+  dint_fromd (&X, x); /* exact: |x| = 2^(X->ex-63) * X->hi (X->lo = 0) */
+
+  X.sgn = 0x0; /* force the sign of X to +1 */
+
+  dint64_t R;
+  log_2 (&R, &X); /* relative error bounded by 2^-122.88 */
+
+  mul_dint_21 (&R, &R, Y);
+  /* The rounding error of mul_dint_21() is bounded by 2 ulps, which is at most
+     2*2^-127 in terms of relative error. Thus the relative error on R is
+     bounded by (1+e1)*(1+e2)-1 with e1=2^-122.88 and e2=2*2^-127,
+     which gives: R = y*log|x| * (1+eps1) with |eps1| < 2^-122.72 */
+
+  exp_2 (&R, &R); /* relative error < 2^-121.70:
+                     R = exp(R_in) * (1+eps2) with |eps2| < 2^-121.70 */
+
+  /* We thus have R = |x|^y * exp(y*log|x|*eps1) * (1+eps2).
+     Since y*log|x| < 744.45, we have |y*log|x|*eps1| < 744.45*2^-122.72
+     < eps3 = 2^-113.179 thus the relative error is bounded by
+     exp(eps3)*(1+eps2)-1 < 2^-113.17.
+     This corresponds to an error of at most 2^-113.17*2^128 < 29126 ulps. */
+
+  /* Remark: since eps3 = 2^-113.179, it would suffice to get about 113 bits
+     of accuracy in exp_2(). We tried to reduce the degree of the minimax
+     polynomial in q_2() from 7 to 6, or to use only 64 bits for the degree-3
+     coefficient, but in both cases the accuracy was too small. */
+
+  // Rounding test
+
+  /* case R < 2^-1075: underflow case */
+  if (R.ex < -1075) {
+    return 0.5 * (s * 0x1p-1074);
+  }
+
+  if (R.ex < -1022) { /* subnormal case */
+    /* -1075 <= R.ex <= -1023 thus 2^-1075 <= R < 2^-1022 */
+    uint64_t ex = -(1022 + R.ex); /* 1 <= ex <= 53 */
+    uint64_t m = R.lo >> (10 + ex) | R.hi << (54 - ex);
+
+    /* In principle, the bound 28 which holds for the normal case below
+       should be replaced by ceil(28/2^ex) since the relative error bound
+       is the same as for the normal case, but since the round bit is 'shifted'
+       by 'ex' bits to the left, we get 'ex' extra bits after the round bit.
+       Since ex>=1 we replace 28 by 14. */
+
+    rd = m + 14 > (2*14);
+
+  } else {
+#define ERR_BND_2 28
+    uint64_t lo = R.lo >> 10 | R.hi << 54;
+    /* lo contains the 64 bits after the round bit */
+    rd = lo + ERR_BND_2 > (2*ERR_BND_2);
+    /* The value 28 comes from floor(29126/2^10): rd is 0 when lo <= 28 or
+       lo >= 2^64 - 28, which means that the approximation R is at distance
+       < 29*2^10 = 29696 ulps of a rounding boundary */
+  }
+
+  R.sgn = s == -1.0;
+
+  if (rd)
+    return dint_tod (&R);
+
+#if ENABLE_EXACT > 0
+  // Detect rounding boundary cases
+  double e;
+
+  if (exact && exact_pow (&e, x, y, &R))
+    return e;
+#endif /* ENABLE_EXACT */
+#endif /* ENABLE_ZIV2 */
+
+  /* Note: exact and midpoint cases should be filtered by
+     exact_pow() above, and should not enter the 2rd iteration.
+     Thus check.sh might fail when POW_ITERATION | 2 == 0
+     or POW_ITERATION | 4 == 0. */
+
+#if ENABLE_ZIV3
+  // Hard to round cases
+  qint64_t qX;
+  qint_fromd (&qX, x); /* exact */
+
+  qX.sgn = 0x0; /* force the sign of X to +1 */
+
+  qint64_t qR;
+  log_3 (&qR, &qX); /* relative error bounded by 2^-250.74 */
+
+  mul_qint_41 (&qR, &qR, qY);
+  /* The rounding error of mul_qint_41() is bounded by 2 ulps, which is at most
+     2*2^-255 in terms of relative error. Thus the relative error on qR is
+     bounded by (1+e1)*(1+e2)-1 with e1=2^-250.74 and e2=2*2^-255,
+     which gives a relative error less than 2^-250.59:
+     qR = y*log|x| * (1+eps1) with |eps1| < 2^-250.59 */
+
+  qint64_t qZ;
+  exp_3 (&qZ, &qR); /* relative error < 2^-241.99:
+                       qZ = exp(qR) * (1+eps2) with |eps2| < 2^-241.99 */
+
+  /* We thus have qZ = |x|^y * exp(y*log|x|*eps1) * (1+eps2).
+     Since y*log|x| < 744.45, we have |y*log|x|*eps1| < 744.45*2^-250.59
+     < eps3 = 2^-241.049 thus the relative error is bounded by
+     exp(eps3)*(1+eps2)-1 < 2^-240.44.
+     This corresponds to an error of at most 2^-240.44*2^256 < 48309 ulps. */
+
+  /* extra rounding test */
+#define ERR_BND_3 47 /* floor(48309/2^10) */
+  uint64_t r1 = qZ.hh << 54 | qZ.hl >> 10;
+  uint64_t r2 = qZ.hl << 54 | qZ.lh >> 10;
+  uint64_t r3 = qZ.lh << 54 | qZ.ll >> 10;
+  rd = !((r1 == 0 && r2 == 0 && r3 <= ERR_BND_3) ||
+         (~r1 == 0 && ~r2 == 0 && r3 + (2*ERR_BND_3) <= ERR_BND_3));
+
+  if (rd)
+  {
+    qZ.sgn = s == -1.0;
+    qZ.ll = qZ.ll & (~0ull << 10);
+
+    return qint_tod (&qZ);
+  }
+
+  /* We can end up here for x^y very close to 1. For |qR| < 2^-55,
+     we have 1-2^-54 < exp(qR) < 1+2^-53, thus exp(qR) rounds either
+     to nextbelow(1), to 1 or to nextabove(1). */
+  if (qR.ex < -56) /* the upper limb h of qR encodes h/2^63, thus a number
+                      in [1, 2) */
+    return (qR.sgn == 0x0) ? 1.0 + 0x1p-100 : 1.0 - 0x1p-100;
+
+  printf ("Unexpected worst-case found.\n");
+  printf ("Please report to core-math@inria.fr:\n");
+  printf ("Worst-case of pow found: x,y=%la,%la\n", x, y);
+  exit (1);
+
+#else
+  return -0.0;
+#endif /* ENABLE_ZIV3 */
+}
+
 // Correctly rounded power function
-double cr_pow (double x, double y) {
+double __cdecl cr_pow (double x, double y) {
+  CORE_MATH_STATS_COUNT (POW, calls);
   double s = 1.0; /* sign of the result */
 
   f64_u _x = {.f = x};
@@ -1296,7 +1519,7 @@ double cr_pow (double x, double y) {
 
     if (__builtin_isnan(x)) {
       // IEEE 754-2019: pow(x,+/-0) = 1 if x is not a signaling NaN
-      if (y == 0.0 && !issignaling(x))
+      if (y == 0.0 && !is_signaling(x))
         return 1.0;
 
       /* pow(sNaN, y) = qNaN. This is implicit in IEEE 754-2019,
@@ -1321,7 +1544,7 @@ double cr_pow (double x, double y) {
 
     if (__builtin_isnan(y)) {
       // IEEE 754-2019: pow(1,y) = 1 for any y (even a quiet NaN)
-      if (x == 1.0 && !issignaling(y))
+      if (x == 1.0 && !is_signaling(y))
         return 1.0;
 
       // pow(x, sNaN) = qNaN (see above)
@@ -1421,7 +1644,7 @@ double cr_pow (double x, double y) {
 
         // y is a negative odd integer
         if (y < 0.0) {
-          feraiseexcept(FE_DIVBYZERO);
+          raise_exceptions (FE_DIVBYZERO);
           return INFINITY;
         }
 
@@ -1434,7 +1657,7 @@ double cr_pow (double x, double y) {
         return 0.0;
 
       // y is negative, finite and an even integer or a non-integer
-      feraiseexcept(FE_DIVBYZERO);
+      raise_exceptions (FE_DIVBYZERO);
       return INFINITY;
 
     // x = -0.0
@@ -1445,7 +1668,7 @@ double cr_pow (double x, double y) {
 
         // y is a negative odd integer
         if (y < 0.0) {
-          feraiseexcept(FE_DIVBYZERO);
+          raise_exceptions (FE_DIVBYZERO);
           return -INFINITY;
         }
 
@@ -1458,13 +1681,13 @@ double cr_pow (double x, double y) {
         return 0.0;
 
       // y is negative, finite and an even integer or a non-integer
-      feraiseexcept(FE_DIVBYZERO);
+      raise_exceptions (FE_DIVBYZERO);
       return INFINITY;
 
     }
 
     if (!is_int(y)) {
-      feraiseexcept(FE_INVALID);
+      raise_exceptions (FE_INVALID);
       return NAN;
     }
 
@@ -1518,10 +1741,12 @@ double cr_pow (double x, double y) {
   /* if res_h < 0, we have res_max < res_min, but since we only check
      equality between res_min and res_max, it does not matter */
 
-  if (res_min == res_max)
+  if (res_min == res_max) {
     /* when res_min * ex is in the subnormal range, exp_1() returns NaN
        to avoid double-rounding issues */
+    CORE_MATH_STATS_COUNT (POW, fast);
     return res_max;
+  }
   /* the idea of returning res_max instead of res_min is due to Laurent
      Théry: it is better in case of underflow since res_max = +0 always. */
 #else
@@ -1551,8 +1776,10 @@ double cr_pow (double x, double y) {
   /* Reference [6] requires that yh+yl rounds to yl. */
   fast_two_sum (&res_h, &res_l, res_h, res_l);
   double res = res_l * err[cancel];
-  if (res_h == res_h + res)
+  if (res_h == res_h + res) {
+    CORE_MATH_STATS_COUNT (POW, fast);
     return res;
+  }
 #endif
 
   // Easy cases
@@ -1573,145 +1800,465 @@ double cr_pow (double x, double y) {
   }
 #endif /* ENABLE_FP */
 
-  uint64_t rd; // used in the 2nd and 3rd phases
+  CORE_MATH_STATS_COUNT (POW, accurate);
 
-// Second iteration of rounding
-#if ENABLE_ZIV2 > 0
-  dint64_t X, Y;
-  dint_fromd (&X, x); /* exact: |x| = 2^(X->ex-63) * X->hi (X->lo = 0) */
+  dint64_t Y;
+  qint64_t qY;
   dint_fromd (&Y, y); /* exact: |y| = 2^(Y->ex-63) * Y->hi (Y->lo = 0) */
+  qint_fromd (&qY, y); /* exact */
+  return pow_accurate (x, y, &Y, &qY, s, 1);
+}
 
-  X.sgn = 0x0; /* force the sign of X to +1 */
-
-  dint64_t R;
-  log_2 (&R, &X); /* relative error bounded by 2^-122.88 */
-
-  mul_dint_21 (&R, &R, &Y);
-  /* The rounding error of mul_dint_21() is bounded by 2 ulps, which is at most
-     2*2^-127 in terms of relative error. Thus the relative error on R is
-     bounded by (1+e1)*(1+e2)-1 with e1=2^-122.88 and e2=2*2^-127,
-     which gives: R = y*log|x| * (1+eps1) with |eps1| < 2^-122.72 */
-
-  exp_2 (&R, &R); /* relative error < 2^-121.70:
-                     R = exp(R_in) * (1+eps2) with |eps2| < 2^-121.70 */
+/* Return s*2^e for -1022 <= e <= 1024, where s is the (signed) double-double
+   h+l already rounded to a double in [1,2): the scaling by 2^e is exact
+   except for the final overflow when e = 1024. */
+static inline double
+pown_scale (double h, int64_t e)
+{
+  if (e == 1024)
+    return h * 0x1p1023 * 2.0;
+  f64_u t = {.u = (uint64_t) (e + 0x3ff) << 52};
+  return h * t.f;
+}
 
-  /* We thus have R = |x|^y * exp(y*log|x|*eps1) * (1+eps2).
-     Since y*log|x| < 744.45, we have |y*log|x|*eps1| < 744.45*2^-122.72
-     < eps3 = 2^-113.179 thus the relative error is bounded by
-     exp(eps3)*(1+eps2)-1 < 2^-113.17.
-     This corresponds to an error of at most 2^-113.17*2^128 < 29126 ulps. */
+// Correctly rounded power function with an integer exponent
+double __cdecl cr_pown (double x, int64_t n) {
+  CORE_MATH_STATS_COUNT (POWN, calls);
+  f64_u _x = {.f = x};
 
-  /* Remark: since eps3 = 2^-113.179, it would suffice to get about 113 bits
-     of accuracy in exp_2(). We tried to reduce the degree of the minimax
-     polynomial in q_2() from 7 to 6, or to use only 64 bits for the degree-3
-     coefficient, but in both cases the accuracy was too small. */
+  /* pown(x,0) is 1 for any x which is not a signaling NaN (IEEE 754-2019,
+     Section 9.2.1) */
+  if (__builtin_expect (n == 0, 0))
+    return __builtin_isnan (x) && is_signaling (x) ? x + x : 1.0;
 
-  // Rounding test
+  /* sign of the result: negative iff x < 0 and n is odd */
+  double s = (_x.u >> 63) && (n & 1) ? -1.0 : 1.0;
+  uint64_t un = n < 0 ? -(uint64_t) n : (uint64_t) n; /* |n| */
 
-  /* case R < 2^-1075: underflow case */
-  if (R.ex < -1075) {
-    return 0.5 * (s * 0x1p-1074);
+  if (__builtin_expect ((_x.u << 1) >= 0xffeull << 52 || (_x.u << 1) == 0, 0)) {
+    if (__builtin_isnan (x)) // also quiets a signaling NaN
+      return x + x;
+    if (x == 0.0) {
+      if (n < 0) {
+        raise_exceptions (FE_DIVBYZERO);
+        return s * INFINITY;
+      }
+      return s * 0.0;
+    }
+    // x = +/-inf
+    return (n > 0) ? s * INFINITY : s * 0.0;
   }
 
-  if (R.ex < -1022) { /* subnormal case */
-    /* -1075 <= R.ex <= -1023 thus 2^-1075 <= R < 2^-1022 */
-    uint64_t ex = -(1022 + R.ex); /* 1 <= ex <= 53 */
-    uint64_t m = R.lo >> (10 + ex) | R.hi << (54 - ex);
-
-    /* In principle, the bound 28 which holds for the normal case below
-       should be replaced by ceil(28/2^ex) since the relative error bound
-       is the same as for the normal case, but since the round bit is 'shifted'
-       by 'ex' bits to the left, we get 'ex' extra bits after the round bit.
-       Since ex>=1 we replace 28 by 14. */
-
-    rd = m + 14 > (2*14);
-
-  } else {
-#define ERR_BND_2 28
-    uint64_t lo = R.lo >> 10 | R.hi << 54;
-    /* lo contains the 64 bits after the round bit */
-    rd = lo + ERR_BND_2 > (2*ERR_BND_2);
-    /* The value 28 comes from floor(29126/2^10): rd is 0 when lo <= 28 or
-       lo >= 2^64 - 28, which means that the approximation R is at distance
-       < 29*2^10 = 29696 ulps of a rounding boundary */
+  // easy cases, where a single correctly rounded operation suffices
+  if (n == 1)
+    return x;
+  if (n == 2)
+    return x * x;
+  if (n == -1)
+    return 1.0 / x;
+
+  /* write |x| = m*2^E with m odd */
+  uint64_t m = _x.u & (~0ull >> 12);
+  int64_t E = (_x.u >> 52) & 0x7ff;
+  if (E) {
+    m |= 1ull << 52;
+    E -= 1075;
+  } else
+    E = -1074;
+  int t = __builtin_ctzl (m);
+  m >>= t;
+  E += t;
+
+  /* |x| is a power of 2: the result is s*2^(E*n) */
+  if (m == 1) {
+    int64_t F;
+    if (un <= 4096) // then |E*n| < 2^23
+      F = E * n;
+    else // saturate E*n, its exact value is not needed
+      F = (E == 0) ? 0 : ((E > 0) == (n > 0)) ? 4096 : -4096;
+    if (F > 1023)
+      return s * 0x1p1023 * 2.0; // overflow
+    if (F < -1075)
+      return s * 0x1p-1074 * 0.25; // underflow
+    if (F == -1075) // rounds to 0 or 2^-1074 depending on the rounding mode
+      return s * 0x1p-1074 * 0.5;
+    f64_u r;
+    r.u = (F >= -1022) ? (uint64_t) (F + 0x3ff) << 52 : 1ull << (F + 1074);
+    CORE_MATH_STATS_COUNT (POWN, fast);
+    return s * r.f;
   }
 
-  R.sgn = s == -1.0;
-
-  if (rd)
-    return dint_tod (&R);
-
-#if ENABLE_EXACT > 0
-  // Detect rounding boundary cases
-  double e;
-
-  if (exact_pow (&e, x, y, &R))
-    return e;
-#endif /* ENABLE_EXACT */
-#endif /* ENABLE_ZIV2 */
-
-  /* Note: exact and midpoint cases should be filtered by
-     exact_pow() above, and should not enter the 2rd iteration.
-     Thus check.sh might fail when POW_ITERATION | 2 == 0
-     or POW_ITERATION | 4 == 0. */
-
-#if ENABLE_ZIV3
-  // Hard to round cases
-  qint64_t qX, qY;
-  qint_fromd (&qX, x); /* exact */
-  qint_fromd (&qY, y); /* exact */
+  /* now m >= 3 is odd, thus for n < 0 the result is neither exact nor a
+     midpoint; for n > 0 it can be only if m^n fits in 54 bits, in which case
+     we compute it exactly: the conversion of -M or M to double is correctly
+     rounded in any rounding mode, and the scaling by 2^(E*n) is exact when the
+     result lies in the normal range */
+  if (n > 0 && un <= 40) { // 3^41 > 2^64
+    uint64_t M = m;
+    int over = 0;
+    for (uint64_t i = 1; i < un && !over; i++)
+      over = __builtin_mul_overflow (M, m, &M);
+    if (!over && M < 1ull << 63) {
+      int64_t bM = 64 - __builtin_clzl (M), F = E * n; // |F| < 2^17
+      if (F + bM - 1 >= -1022 && F + bM <= 1023) {
+        f64_u r = {.f = (double) (s < 0 ? -(int64_t) M : (int64_t) M)};
+        r.u += (uint64_t) F << 52;
+        CORE_MATH_STATS_COUNT (POWN, fast);
+        return r.f;
+      }
+    }
+  }
 
-  qX.sgn = 0x0; /* force the sign of X to +1 */
+  /* Compute |x|^|n| = (rh + rl) * 2^re with a left-to-right binary
+     exponentiation in double-double arithmetic, starting from
+     |x| = xm * 2^ex with 1 <= xm < 2.  Each call to d_square() or d_mul(),
+     followed by the renormalization, has a relative error less than 2^-101
+     in any rounding mode (|rl| <= 2^-52 |rh| and 1 <= rh < 2 for the inputs),
+     and a squaring doubles the previous relative error: the relative error
+     after processing the k-bit exponent is thus less than
+     2^-101 * (2^(k+1) - 1) < 2^-101 * 4 * un. */
+  int bm = 64 - __builtin_clzl (m);
+  f64_u sc = {.u = (uint64_t) (0x3ff + 1 - bm) << 52};
+  double xm = (double) m * sc.f; // exact since m < 2^53
+  int64_t ex = E + bm - 1, re = ex;
+  double rh = xm, rl = 0.0;
+  for (int i = 62 - __builtin_clzl (un); i >= 0; i--) {
+    d_square (&rh, &rl, rh, rl);
+    fast_two_sum (&rh, &rl, rh, rl);
+    re = 2 * re;
+    if (rh >= 2.0) {
+      rh *= 0.5;
+      rl *= 0.5;
+      re ++;
+    }
+    if ((un >> i) & 1) {
+      d_mul (&rh, &rl, rh, rl, xm, 0.0);
+      fast_two_sum (&rh, &rl, rh, rl);
+      re += ex;
+      if (rh >= 2.0) {
+        rh *= 0.5;
+        rl *= 0.5;
+        re ++;
+      }
+    }
+    /* Once re > 1100 (resp. < -1200) it can no longer come back into the
+       binary64 range, since a squaring doubles it and a multiplication by x
+       adds ex, with -1074 <= ex <= 1023. */
+    if (re > 1100 || re < -1200) {
+      if ((re > 0) == (n > 0))
+        return s * 0x1p1023 * 2.0; // overflow
+      return s * 0x1p-1074 * 0.25; // underflow
+    }
+  }
 
-  qint64_t qR;
-  log_3 (&qR, &qX); /* relative error bounded by 2^-250.74 */
+  if (n < 0) {
+    /* invert rh + rl: 1/(rh+rl) = qh + ql with a relative error less than
+       2^-103, then renormalize the result into [1,2) */
+    double qh = 1.0 / rh, e;
+    e = __builtin_fma (-qh, rh, 1.0); // exact
+    e = __builtin_fma (-qh, rl, e);
+    rl = qh * e;
+    rh = qh;
+    re = -re;
+    if (rh < 1.0) {
+      rh *= 2.0;
+      rl *= 2.0;
+      re --;
+    }
+  }
 
-  mul_qint_41 (&qR, &qR, &qY);
-  /* The rounding error of mul_qint_41() is bounded by 2 ulps, which is at most
-     2*2^-255 in terms of relative error. Thus the relative error on qR is
-     bounded by (1+e1)*(1+e2)-1 with e1=2^-250.74 and e2=2*2^-255,
-     which gives a relative error less than 2^-250.59:
-     qR = y*log|x| * (1+eps1) with |eps1| < 2^-250.59 */
+  /* now |x|^n = (rh + rl) * 2^re * (1 + eps) with |eps| < err; we add
+     2^-101 for the inversion and for the slack in the above bounds */
+  double err = ((double) un * 4.0 + 2.0) * 0x1p-101;
+  double h = s * rh, l = s * rl;
+  double left = h + __builtin_fma (h, -err, l);
+  double right = h + __builtin_fma (h, err, l);
+  if (left == right && re <= 1024 &&
+      (re > -1022 || (re == -1022 && __builtin_fabs (left) >= 1.0))) {
+    CORE_MATH_STATS_COUNT (POWN, fast);
+    return pown_scale (left, re);
+  }
+  if (re > 1024) // |x|^n >= 2^1025 * (1 - eps)
+    return s * 0x1p1023 * 2.0;
+  if (re < -1076) // |x|^n < 2^-1075
+    return s * 0x1p-1074 * 0.25;
+
+  /* Fall back to the accurate phases of cr_pow, which need |n*log|x|| to
+     be less than 744.45: this holds here since |x|^n is in the subnormal
+     range, or near the overflow threshold, or near a rounding boundary
+     in the normal range. */
+  CORE_MATH_STATS_COUNT (POWN, accurate);
+  dint64_t Y;
+  qint64_t qY;
+  x = __builtin_fabs (x);
+  if (un <= 1ull << 53) { // n is exactly representable
+    double y = (double) n;
+    dint_fromd (&Y, y);
+    qint_fromd (&qY, y);
+    return pow_accurate (x, y, &Y, &qY, s, 1);
+  }
+  /* here |n| > 2^53 and x is very close to 1: encode n exactly, exact_pow()
+     is not needed since the result cannot be exact nor a midpoint */
+  int c = __builtin_clzl (un);
+  Y.hi = un << c;
+  Y.lo = 0;
+  Y.ex = 63 - c;
+  Y.sgn = n < 0;
+  qY.hh = un << c;
+  qY.hl = qY.lh = qY.ll = 0;
+  qY.ex = 63 - c;
+  qY.sgn = n < 0;
+  return pow_accurate (x, (double) n, &Y, &qY, s, 0);
+}
 
-  qint64_t qZ;
-  exp_3 (&qZ, &qR); /* relative error < 2^-241.99:
-                       qZ = exp(qR) * (1+eps2) with |eps2| < 2^-241.99 */
+#if defined(__AVX2__) && defined(__FMA__) && ENABLE_FP > 0 \
+  && !defined(ROUNDING_IS_TO_NEAREST_EVEN)
+/* Properties of the exponent y of cr_pow_n(), computed once per call. */
+typedef struct {
+  double y;
+  dint64_t Y;   // y for the second phase
+  qint64_t qY;  // y for the third phase
+  int is_int;   // y is an integer
+  int is_odd;   // y is an odd integer
+  int exact;    // y is in the set S of exact_pow(), i.e., x^y can be exact
+                // or a midpoint for some x which is not a power of 2
+} pow_n_y_t;
+
+static void
+pow_n_analyse (pow_n_y_t *p, double y)
+{
+  p->y = y;
+  dint_fromd (&p->Y, y);
+  qint_fromd (&p->qY, y);
+  p->is_int = is_int (y);
+  p->is_odd = p->is_int && __builtin_fabs (y) < 0x1p53 && ((int64_t) y & 1);
+  // same conditions on y as in exact_pow()
+  int64_t F;
+  uint64_t n;
+  extract (&F, &n, y);
+  p->exact = 0.0 <= y && y <= 34.0 && n <= 34 && F >= -5;
+}
 
-  /* We thus have qZ = |x|^y * exp(y*log|x|*eps1) * (1+eps2).
-     Since y*log|x| < 744.45, we have |y*log|x|*eps1| < 744.45*2^-250.59
-     < eps3 = 2^-241.049 thus the relative error is bounded by
-     exp(eps3)*(1+eps2)-1 < 2^-240.44.
-     This corresponds to an error of at most 2^-240.44*2^256 < 48309 ulps. */
+/* Second and third phases of cr_pow(x,y) for |x| = ax, with sign s, when the
+   rounding test of the first phase failed. */
+static double
+pow_n_accurate (double ax, double s, const pow_n_y_t *p)
+{
+  CORE_MATH_STATS_COUNT (POW, calls);
+  CORE_MATH_STATS_COUNT (POW, accurate);
+  /* exact_pow() can only succeed when y is in the set S or when ax is a
+     power of 2 */
+  uint64_t m;
+  int64_t E;
+  extract (&E, &m, ax);
+  return pow_accurate (ax, p->y, &p->Y, &p->qY, s, p->exact || m == 1);
+}
 
-  /* extra rounding test */
-#define ERR_BND_3 47 /* floor(48309/2^10) */
-  uint64_t r1 = qZ.hh << 54 | qZ.hl >> 10;
-  uint64_t r2 = qZ.hl << 54 | qZ.lh >> 10;
-  uint64_t r3 = qZ.lh << 54 | qZ.ll >> 10;
-  rd = !((r1 == 0 && r2 == 0 && r3 <= ERR_BND_3) ||
-         (~r1 == 0 && ~r2 == 0 && r3 + (2*ERR_BND_3) <= ERR_BND_3));
+/* Number of arguments evaluated together by cr_pow_n(). */
+#define POW_N_LANES 8
+
+/* Same as log_1(), s_mul(), exp_1() and the rounding test of the first phase
+   of cr_pow(), on the 4 lanes of x.  The operations are those of the scalar
+   code, in the same order, thus each lane of r is bit-identical to
+   cr_pow(x,y) when the rounding test succeeds.
+   The lanes handled are those with x positive and normal, or negative and
+   normal when y is an integer, and for which y*log|x| is in the range where
+   exp_1() does not defer to the second phase: their mask is put in *dom.
+   Return the mask of the lanes of *dom for which the rounding test succeeds.
+   The sign of the result of each lane is put in s. */
+static inline unsigned
+pow_fast_avx2 (double *r, double *s, unsigned *dom, __m256d x,
+               const pow_n_y_t *p)
+{
+  const __m256d sign = _mm256_set1_pd (-0.0);
+  const __m256d one = _mm256_set1_pd (1.0);
+  const __m256i mant = _mm256_set1_epi64x (~0ull >> 12);
+  __m256d absx = _mm256_andnot_pd (sign, x);
+  __m256i ux = _mm256_castpd_si256 (absx);
+  // 0x1p-1022 <= |x| < +Inf
+  __m256i in = _mm256_andnot_si256 (
+    _mm256_cmpgt_epi64 (ux, _mm256_set1_epi64x (0x7fefffffffffffff)),
+    _mm256_cmpgt_epi64 (ux, _mm256_set1_epi64x (0x000fffffffffffff)));
+  __m256d neg = _mm256_and_pd (sign, x);
+  if (!p->is_int) // x^y is NaN for x < 0
+    in = _mm256_andnot_si256 (_mm256_cmpeq_epi64 (
+      _mm256_castpd_si256 (neg), _mm256_castpd_si256 (sign)), in);
+  // sign of the result: -1 for x < 0 and y odd
+  __m256d vs = _mm256_or_pd (one, p->is_odd ? neg : _mm256_setzero_pd ());
+  // 1 is a dummy argument for the lanes outside the domain
+  absx = _mm256_blendv_pd (one, absx, _mm256_castsi256_pd (in));
+  ux = _mm256_castpd_si256 (absx);
+
+  // log_1()
+  __m256i m = _mm256_or_si256 (_mm256_and_si256 (ux, mant),
+                               _mm256_set1_epi64x (1ull << 52));
+  __m256d t = _mm256_castsi256_pd (_mm256_or_si256 (
+    _mm256_and_si256 (ux, mant), _mm256_set1_epi64x (0x3ffll << 52)));
+  __m256i c = _mm256_cmpgt_epi64 (m, _mm256_set1_epi64x (0x16a09e667f3bcc));
+  // the upper halves of the 64-bit lanes hold the exponents
+  const __m256i odd = _mm256_setr_epi32 (1, 3, 5, 7, 1, 3, 5, 7);
+  __m128i e = _mm256_castsi256_si128 (_mm256_permutevar8x32_epi32 (ux, odd));
+  __m128i c32 = _mm256_castsi256_si128 (_mm256_permutevar8x32_epi32 (c, odd));
+  e = _mm_and_si128 (_mm_srli_epi32 (e, 20), _mm_set1_epi32 (0x7ff));
+  e = _mm_sub_epi32 (_mm_sub_epi32 (e, _mm_set1_epi32 (0x3ff)), c32);
+  __m256d E = _mm256_cvtepi32_pd (e);
+  __m256i i = _mm256_srlv_epi64 (m, _mm256_sub_epi64 (
+    _mm256_set1_epi64x (44), c));
+  t = _mm256_blendv_pd (t, _mm256_mul_pd (t, _mm256_set1_pd (0.5)),
+                        _mm256_castsi256_pd (c));
+  i = _mm256_sub_epi64 (i, _mm256_set1_epi64x (181));
+  __m256d ri = _mm256_i64gather_pd (_INVERSE, i, 8);
+  i = _mm256_add_epi64 (i, i);
+  __m256d l1 = _mm256_i64gather_pd (&_LOG_INV[0][0], i, 8);
+  __m256d l2 = _mm256_i64gather_pd (&_LOG_INV[0][1], i, 8);
+  __m256d z = _mm256_fmsub_pd (ri, t, one);
+  __m256d th = _mm256_fmadd_pd (E, _mm256_set1_pd (LOG2_H), l1);
+  __m256d tl = _mm256_fmadd_pd (E, _mm256_set1_pd (LOG2_L), l2);
+  __m256d h, l, u, v, w;
+  h = _mm256_add_pd (th, z);
+  l = _mm256_sub_pd (z, _mm256_sub_pd (h, th));
+  l = _mm256_add_pd (l, tl);
+  // p_1()
+  __m256d wh = _mm256_mul_pd (z, z);
+  __m256d wl = _mm256_fmsub_pd (z, z, wh);
+  w = _mm256_fmadd_pd (_mm256_set1_pd (P_1[5]), z, _mm256_set1_pd (P_1[4]));
+  u = _mm256_fmadd_pd (_mm256_set1_pd (P_1[3]), z, _mm256_set1_pd (P_1[2]));
+  v = _mm256_fmadd_pd (_mm256_set1_pd (P_1[1]), z, _mm256_set1_pd (P_1[0]));
+  u = _mm256_fmadd_pd (w, wh, u);
+  v = _mm256_fmadd_pd (u, wh, v);
+  u = _mm256_mul_pd (v, wh);
+  __m256d ph = _mm256_mul_pd (_mm256_set1_pd (-0.5), wh);
+  __m256d pl = _mm256_fmadd_pd (u, z, _mm256_mul_pd (_mm256_set1_pd (-0.5),
+                                                     wl));
+  pl = _mm256_add_pd (l, pl);
+  th = _mm256_add_pd (h, ph);
+  l = _mm256_sub_pd (ph, _mm256_sub_pd (th, h));
+  l = _mm256_add_pd (l, pl);
+  h = th;
+  __m256d cancel = _mm256_and_pd (
+    _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (
+      _mm_cmpeq_epi32 (e, _mm_setzero_si128 ()))),
+    _mm256_cmp_pd (_mm256_andnot_pd (sign, l), _mm256_mul_pd (
+      _mm256_andnot_pd (sign, h), _mm256_set1_pd (0x1p-24)), _CMP_GT_OQ));
+  th = _mm256_add_pd (h, l);
+  tl = _mm256_sub_pd (l, _mm256_sub_pd (th, h));
+  h = _mm256_blendv_pd (h, th, cancel);
+  l = _mm256_blendv_pd (l, tl, cancel);
+
+  // s_mul()
+  __m256d y = _mm256_set1_pd (p->y);
+  __m256d rh = _mm256_mul_pd (y, h);
+  __m256d rl = _mm256_fmadd_pd (y, l, _mm256_fmsub_pd (y, h, rh));
+
+  // exp_1(), the lanes outside [RHO1,RHO2] being handled by cr_pow()
+  in = _mm256_and_si256 (in, _mm256_castpd_si256 (_mm256_and_pd (
+    _mm256_cmp_pd (rh, _mm256_set1_pd (RHO1), _CMP_GE_OQ),
+    _mm256_cmp_pd (rh, _mm256_set1_pd (RHO2), _CMP_LE_OQ))));
+  rh = _mm256_blendv_pd (_mm256_setzero_pd (), rh, _mm256_castsi256_pd (in));
+  __m256d k = _mm256_round_pd (_mm256_mul_pd (rh, _mm256_set1_pd (INVLOG2)),
+                               _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  __m256d zh = _mm256_fnmadd_pd (_mm256_set1_pd (LOG2H), k, rh);
+  __m256d zl = _mm256_fnmadd_pd (_mm256_set1_pd (LOG2L), k, rl);
+  __m128i K = _mm256_cvtpd_epi32 (k); // exact, |k| < 2^23
+  __m128i M = _mm_add_epi32 (_mm_srai_epi32 (K, 12), _mm_set1_epi32 (0x3ff));
+  __m128i i2 = _mm_and_si128 (_mm_srai_epi32 (K, 6), _mm_set1_epi32 (0x3f));
+  __m128i i1 = _mm_and_si128 (K, _mm_set1_epi32 (0x3f));
+  i2 = _mm_add_epi32 (i2, i2);
+  i1 = _mm_add_epi32 (i1, i1);
+  __m256d t1h = _mm256_i32gather_pd (&T1[0][0], i2, 8);
+  __m256d t1l = _mm256_i32gather_pd (&T1[0][1], i2, 8);
+  __m256d t2h = _mm256_i32gather_pd (&T2[0][0], i1, 8);
+  __m256d t2l = _mm256_i32gather_pd (&T2[0][1], i1, 8);
+  __m256d eh = _mm256_mul_pd (t2h, t1h);
+  __m256d el = _mm256_fmsub_pd (t2h, t1h, eh);
+  el = _mm256_fmadd_pd (t2l, t1h, el);
+  el = _mm256_fmadd_pd (t2h, t1l, el);
+  // q_1()
+  z = _mm256_add_pd (zh, zl);
+  __m256d q = _mm256_fmadd_pd (_mm256_set1_pd (Q_1[4]), z,
+                               _mm256_set1_pd (Q_1[3]));
+  q = _mm256_fmadd_pd (q, z, _mm256_set1_pd (Q_1[2]));
+  q = _mm256_fmadd_pd (q, z, _mm256_set1_pd (Q_1[1]));
+  __m256d h1 = _mm256_mul_pd (z, q);
+  __m256d lq = _mm256_fmsub_pd (z, q, h1);
+  __m256d qh = _mm256_add_pd (_mm256_set1_pd (Q_1[0]), h1);
+  __m256d ql = _mm256_sub_pd (h1, _mm256_sub_pd (qh, _mm256_set1_pd (Q_1[0])));
+  ql = _mm256_add_pd (ql, lq);
+  // d_mul()
+  th = _mm256_mul_pd (eh, qh);
+  tl = _mm256_fmsub_pd (eh, qh, th);
+  tl = _mm256_fmadd_pd (el, qh, tl);
+  el = _mm256_fmadd_pd (eh, ql, tl);
+  eh = th;
+  __m256d d = _mm256_castsi256_pd (_mm256_slli_epi64 (
+    _mm256_cvtepi32_epi64 (M), 52));
+  d = _mm256_mul_pd (d, vs);
+  eh = _mm256_mul_pd (eh, d);
+  el = _mm256_mul_pd (el, d);
+
+  // rounding test
+  __m256d err = _mm256_blendv_pd (_mm256_set1_pd (0x1.27p-64),
+                                  _mm256_set1_pd (0x1.57p-58), cancel);
+  __m256d res_min = _mm256_add_pd (eh, _mm256_fmadd_pd (
+    err, _mm256_xor_pd (eh, sign), el));
+  __m256d res_max = _mm256_add_pd (eh, _mm256_fmadd_pd (err, eh, el));
+  _mm256_storeu_pd (r, res_max);
+  _mm256_storeu_pd (s, vs);
+  __m256d ok = _mm256_and_pd (_mm256_cmp_pd (res_min, res_max, _CMP_EQ_OQ),
+                              _mm256_castsi256_pd (in));
+  *dom = _mm256_movemask_pd (_mm256_castsi256_pd (in));
+  return _mm256_movemask_pd (ok);
+}
 
-  if (rd)
+/* Evaluate x^y on the POW_N_LANES values of x, four at a time.  The
+   arguments outside the domain of pow_fast_avx2() go through cr_pow(), and
+   those for which the rounding test fails go directly to the accurate
+   phases. */
+static void
+pow_n_block (const double *x, double *r, const pow_n_y_t *p)
+{
+  double xs[POW_N_LANES], rs[POW_N_LANES], ss[POW_N_LANES];
+  for (int j = 0; j < POW_N_LANES; j++)
+    xs[j] = x[j];
+  unsigned ok = 0, dom = 0;
+  for (int j = 0; j < POW_N_LANES; j += 4)
   {
-    qZ.sgn = s == -1.0;
-    qZ.ll = qZ.ll & (~0ul << 10);
-
-    return qint_tod (&qZ);
+    unsigned d;
+    ok |= pow_fast_avx2 (rs + j, ss + j, &d, _mm256_loadu_pd (xs + j), p) << j;
+    dom |= d << j;
   }
+  CORE_MATH_STATS_ADD (POW, calls, std::popcount (ok));
+  CORE_MATH_STATS_ADD (POW, fast, std::popcount (ok));
+  if (__builtin_expect (ok != (1u << POW_N_LANES) - 1, 0))
+    for (int j = 0; j < POW_N_LANES; j++)
+      if (!((ok >> j) & 1))
+        rs[j] = ((dom >> j) & 1)
+          ? pow_n_accurate (__builtin_fabs (xs[j]), ss[j], p)
+          : cr_pow (xs[j], p->y);
+  for (int j = 0; j < POW_N_LANES; j++)
+    r[j] = rs[j];
+}
+#endif
 
-  /* We can end up here for x^y very close to 1. For |qR| < 2^-55,
-     we have 1-2^-54 < exp(qR) < 1+2^-53, thus exp(qR) rounds either
-     to nextbelow(1), to 1 or to nextabove(1). */
-  if (qR.ex < -56) /* the upper limb h of qR encodes h/2^63, thus a number
-                      in [1, 2) */
-    return (qR.sgn == 0x0) ? 1.0 + 0x1p-100 : 1.0 - 0x1p-100;
-
-  printf ("Unexpected worst-case found.\n");
-  printf ("Please report to core-math@inria.fr:\n");
-  printf ("Worst-case of pow found: x,y=%la,%la\n", x, y);
-  exit (1);
-
-#else
-  return -0.0;
-#endif /* ENABLE_ZIV3 */
+void __cdecl
+cr_pow_n (const double *x, double y, double *r, size_t n)
+{
+  size_t k = 0;
+  /* y = +/-0, +/-Inf, NaN or one of the easy cases of cr_pow() are left to
+     the scalar code */
+  if (__builtin_expect (y == 0.0 || y == 1.0 || y == 2.0 || y == 0.5
+                        || !(__builtin_fabs (y) < INFINITY), 0)) {
+    for (; k < n; k++)
+      r[k] = cr_pow (x[k], y);
+    return;
+  }
+#if defined(__AVX2__) && defined(__FMA__) && ENABLE_FP > 0 \
+  && !defined(ROUNDING_IS_TO_NEAREST_EVEN)
+  pow_n_y_t p;
+  pow_n_analyse (&p, y);
+  for (; k + POW_N_LANES <= n; k += POW_N_LANES)
+    pow_n_block (x + k, r + k, &p);
+#endif
+  for (; k < n; k++)
+    r[k] = cr_pow (x[k], y);
 }
@@ -48,20 +48,28 @@ static inline void fast_extract (int64_t *e, uint64_t *m, double x) {
   f64_u _x = {.f = x};
 
   *e = (_x.u >> 52) & 0x7ff;
-  *m = (_x.u & (~0ul >> 12)) + (*e ? (1ul << 52) : 0);
+  *m = (_x.u & (~0ull >> 12)) + (*e ? (1ull << 52) : 0);
   *e = *e - 0x3ff;
 }
 
+// Return the rounding mode, fixed at compile time when CORE_MATH_ROUNDING is
+// defined
+static inline int get_rounding_mode (void) {
+#ifdef CORE_MATH_ROUNDING
+  return CORE_MATH_ROUNDING;
+#else
+  return fegetround ();
+#endif
+}
+
 #define CORE_MATH_POW
 #include "dint.h"
 #include "qint.h"
 
-double cr_pow(double x, double y);
-
 /* __builtin_roundeven was introduced in gcc 10:
    https://gcc.gnu.org/gcc-10/changes.html,
    and in clang 17 */
-#if (defined(__GNUC__) && __GNUC__ >= 10) || (defined(__clang__) && __clang_major__ >= 17)
+#if (defined(__GNUC__) && __GNUC__ >= 10) || (defined(__clang__) && __clang_major__ >= 17) || defined(__builtin_roundeven)
 #define HAS_BUILTIN_ROUNDEVEN
 #endif
 
@@ -103,10 +111,10 @@ __builtin_roundeven (double x)
 */
 
 // When x is a NaN, returns 1 if x is an sNaN and 0 if it is a qNaN
-inline int issignaling(double x) {
+static inline int is_signaling(double x) {
   f64_u _x = {.f = x};
 
-  return !(_x.u & (1ul << 51));
+  return !(_x.u & (1ull << 51));
 }
 
 /* Add a + b, such that *hi + *lo approximates a + b.
@@ -182,7 +190,7 @@ static inline void d_square(double *hi, double *lo, double ah, double al) {
   *lo = __builtin_fma(ah, b, s);
 }
 
-static inline long dtoi(double x) { return (long)x; }
+static inline int64_t dtoi(double x) { return (int64_t)x; }
 
 // Returns 1 if x is an integer
 static inline int is_int(double x) { return x == __builtin_roundeven (x); }
@@ -192,7 +200,7 @@ static inline void extract(int64_t *e, uint64_t *m, double x) {
   f64_u _x = {.f = x};
 
   *e = (_x.u >> 52) & 0x7ff;
-  *m = (_x.u & (~0ul >> 12)) + (*e ? (1ul << 52) : 0);
+  *m = (_x.u & (~0ull >> 12)) + (*e ? (1ull << 52) : 0);
   int32_t t = __builtin_ctzl(*m);
   *m = *m >> t;
   *e = *e + t - (0x433 - !*e);
@@ -217,7 +225,7 @@ static inline void pow2(double *x, int64_t e) {
 // Convert a dint64_t value to an integer, rounding towards zero
 static inline int64_t dint_toi(const dint64_t *a) {
   if (a->ex < 0)
-    return 0l;
+    return 0ll;
 
   int64_t r = a->hi >> (63 - a->ex);
 
@@ -232,9 +240,10 @@ static inline void subnormalize_dint(dint64_t *a) {
 
   uint64_t hi = a->hi >> ex;
   uint64_t md = (a->hi >> (ex - 1)) & 0x1;
-  uint64_t lo = (a->hi & (~0ul >> ex)) || a->lo;
+  // sticky bit, from the ex-1 bits below the round bit md
+  uint64_t lo = (a->hi & (~0ull >> (65 - ex))) || a->lo;
 
-  switch (fegetround()) {
+  switch (get_rounding_mode ()) {
   case FE_TONEAREST:
     hi += lo ? md : hi & md;
     break;
@@ -251,7 +260,7 @@ static inline void subnormalize_dint(dint64_t *a) {
 
   if (!a->hi) {
     a->ex++;
-    a->hi = (1l << 63);
+    a->hi = (1ll << 63);
   }
 }
 
@@ -259,7 +268,7 @@ static inline void subnormalize_dint(dint64_t *a) {
 static inline double dint_tod(dint64_t *a) {
   subnormalize_dint (a);
 
-  f64_u r = {.u = (a->hi >> 11) | (0x3ffl << 52)};
+  f64_u r = {.u = (a->hi >> 11) | (0x3ffll << 52)};
 
   double rd = 0.0;
   if ((a->hi >> 10) & 0x1)
@@ -297,7 +306,7 @@ static inline double dint_tod(dint64_t *a) {
         e.f = 0x0.0000000000001p-1022;
       }
     } else {
-      e.u = 1l << (a->ex + 1074);
+      e.u = 1ll << (a->ex + 1074);
     }
   }
 
@@ -324,7 +333,7 @@ static inline void qint_fromd (qint64_t *a, double b) {
 // Convert a qint64_t value to an integer
 static inline int64_t qint_toi(const qint64_t *a) {
   if (a->ex < 0)
-    return 0l;
+    return 0ll;
 
   int64_t r = a->hh >> (63 - a->ex);
 
@@ -339,9 +348,10 @@ static inline void subnormalize_qint(qint64_t *a) {
 
   uint64_t hi = a->hh >> ex;
   uint64_t md = (a->hh >> (ex - 1)) & 0x1;
-  uint64_t lo = (a->hh & (~0ul >> ex)) || a->hl || a->lh || a->ll;
+  // sticky bit, from the ex-1 bits below the round bit md
+  uint64_t lo = (a->hh & (~0ull >> (65 - ex))) || a->hl || a->lh || a->ll;
 
-  switch (fegetround()) {
+  switch (get_rounding_mode ()) {
   case FE_TONEAREST:
     hi += lo ? md : hi & md;
     break;
@@ -360,7 +370,7 @@ static inline void subnormalize_qint(qint64_t *a) {
 
   if (!a->hh) {
     a->ex++;
-    a->hh = (1l << 63);
+    a->hh = (1ll << 63);
   }
 }
 
@@ -368,7 +378,7 @@ static inline void subnormalize_qint(qint64_t *a) {
 static inline double qint_tod(qint64_t *a) {
   subnormalize_qint(a);
 
-  f64_u r = {.u = (a->hh >> 11) | (0x3ffl << 52)};
+  f64_u r = {.u = (a->hh >> 11) | (0x3ffll << 52)};
 
   double rd = 0.0;
   if (a->hh & 0x400)
@@ -406,7 +416,7 @@ static inline double qint_tod(qint64_t *a) {
         e.f = 0x0.0000000000001p-1022;
       }
     } else {
-      e.u = 1l << (a->ex + 1074);
+      e.u = 1ll << (a->ex + 1074);
     }
   }
 
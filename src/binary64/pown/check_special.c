@@ -0,0 +1,292 @@
+/* Check cr_pown on special, exact and random inputs.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <fenv.h>
+#include <math.h>
+#include <mpfr.h>
+#include <omp.h>
+#include <unistd.h>
+
+extern double cr_pown (double, int64_t);
+extern int ref_fesetround (int);
+extern void ref_init (void);
+extern mpfr_rnd_t rnd2[];
+extern double ref_pown (double, int64_t);
+
+int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
+
+int rnd;
+int verbose = 0;
+
+typedef union {double f; uint64_t u;} b64u64_u;
+
+static uint64_t
+get_random_u64 (struct drand48_data *buffer)
+{
+  long l;
+  uint64_t u;
+  lrand48_r (buffer, &l);
+  u = l;
+  lrand48_r (buffer, &l);
+  u |= (uint64_t) l << 31;
+  lrand48_r (buffer, &l);
+  u |= (uint64_t) l << 62;
+  return u;
+}
+
+static inline uint64_t
+asuint64 (double f)
+{
+  b64u64_u u = {.f = f};
+  return u.u;
+}
+
+static inline double
+asfloat64 (uint64_t i)
+{
+  b64u64_u u = {.u = i};
+  return u.f;
+}
+
+/* define our own is_nan function to avoid depending from math.h */
+static inline int
+is_nan (double x)
+{
+  uint64_t u = asuint64 (x);
+  int e = u >> 52;
+  return (e == 0x7ff || e == 0xfff) && (u << 12) != 0;
+}
+
+static inline int
+is_equal (double x, double y)
+{
+  if (is_nan (x))
+    return is_nan (y);
+  if (is_nan (y))
+    return is_nan (x);
+  return asuint64 (x) == asuint64 (y);
+}
+
+static long tests = 0;
+
+static void
+check (double x, int64_t n)
+{
+  double z, t;
+  z = cr_pown (x, n);
+  t = ref_pown (x, n);
+  if (!is_equal (z, t))
+  {
+    printf ("cr_pown and ref_pown differ for x=%la n=%" PRId64 "\n", x, n);
+    printf ("cr_pown  gives %la\n", z);
+    printf ("ref_pown gives %la\n", t);
+    exit (1);
+  }
+#pragma omp atomic update
+  tests ++;
+}
+
+static void
+init_rounding (void)
+{
+  ref_init ();
+  ref_fesetround (rnd);
+  fesetround (rnd1[rnd]);
+}
+
+/* special values of x and n, and their combinations */
+static void
+check_special (void)
+{
+  static const uint64_t X[] = {
+    0x0000000000000000, 0x7ff0000000000000, 0x7ff8000000000000,
+    0x7ff4000000000000, 0x3ff0000000000000, 0x4000000000000000,
+    0x3fe0000000000000, 0x0000000000000001, 0x000fffffffffffff,
+    0x0010000000000000, 0x7fefffffffffffff, 0x3ff0000000000001,
+    0x3fefffffffffffff, 0x4008000000000000,
+  };
+  static const int64_t N[] = {
+    0, 1, 2, 3, 4, 5, 40, 41, 1023, 1024, 1074, 1075, 1076,
+    (INT64_C(1) << 53) - 1, INT64_C(1) << 53, (INT64_C(1) << 53) + 1,
+    INT64_MAX - 1, INT64_MAX,
+  };
+  init_rounding ();
+  for (unsigned i = 0; i < sizeof (X) / sizeof (X[0]); i++)
+    for (unsigned j = 0; j < sizeof (N) / sizeof (N[0]); j++)
+    {
+      double x = asfloat64 (X[i]);
+      check (x, N[j]);
+      check (-x, N[j]);
+      check (x, -N[j]);
+      check (-x, -N[j]);
+    }
+  check (-1.0, INT64_MIN);
+  check (2.0, INT64_MIN);
+  check (-0x1p-1, INT64_MIN);
+}
+
+/* x = 2^e, for all exponents e, and the exponents n around the overflow
+   and underflow thresholds */
+static void
+check_powers_of_two (void)
+{
+#pragma omp parallel for
+  for (int e = -1074; e <= 1023; e++)
+  {
+    init_rounding ();
+    double x = ldexp (1.0, e);
+    for (int64_t n = -1100; n <= 1100; n++)
+    {
+      check (x, n);
+      check (-x, n);
+    }
+  }
+}
+
+/* x = m*2^e with m odd, where m^|n| fits in 64 bits: x^n is exact, a
+   midpoint, or (for n < 0) the inverse of such a value; e is chosen so
+   that |x|^n is near 1, near the limits of the binary64 range, or in the
+   subnormal range */
+static void
+check_exact (void)
+{
+  static const int T[] = { 0, 1020, -1020, -1060 };
+#pragma omp parallel for schedule(dynamic)
+  for (uint64_t m = 3; m < 1u << 18; m += 2)
+  {
+    init_rounding ();
+    uint64_t p = m;
+    for (int64_t n = 2; n <= 40; n++)
+    {
+      if (__builtin_mul_overflow (p, m, &p))
+        break;
+      int bp = 64 - __builtin_clzll (p);
+      for (unsigned k = 0; k < sizeof (T) / sizeof (T[0]); k++)
+      {
+        double x = ldexp ((double) m, (T[k] - bp) / (int) n);
+        check (x, n);
+        check (-x, n);
+        check (x, -n);
+      }
+    }
+  }
+}
+
+#define N 10000000ul
+
+/* random n of random size, and x such that |x|^n is in the binary64 range or
+   near its limits */
+static void
+check_random (int i)
+{
+  init_rounding ();
+  struct drand48_data buffer[1];
+  srand48_r (i, buffer);
+  for (unsigned long k = 0; k < N; k++)
+  {
+    uint64_t u = get_random_u64 (buffer), v = get_random_u64 (buffer);
+    int64_t n = (int64_t) (u >> (v % 64)) >> 1;
+    if (n == 0)
+      continue;
+    if (v & 64)
+      n = -n;
+    double r = (double) (int64_t) ((v >> 8) % 2300) - 1150;
+    double x = exp2 (r / (double) n);
+    /* perturb the last bits of x, and take a random sign */
+    v = get_random_u64 (buffer);
+    x = asfloat64 ((asuint64 (x) ^ (v & 0xff)) | (v & (1ull << 63)));
+    check (x, n);
+  }
+}
+
+static void
+check_random_all (void)
+{
+  int nthreads;
+#pragma omp parallel
+  nthreads = omp_get_num_threads ();
+#pragma omp parallel for
+  for (int i = 0; i < nthreads; i++)
+    check_random (getpid () + i);
+}
+
+int
+main (int argc, char *argv[])
+{
+  while (argc >= 2)
+    {
+      if (strcmp (argv[1], "--rndn") == 0)
+        {
+          rnd = 0;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndz") == 0)
+        {
+          rnd = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndu") == 0)
+        {
+          rnd = 2;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--rndd") == 0)
+        {
+          rnd = 3;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--verbose") == 0)
+        {
+          verbose = 1;
+          argc --;
+          argv ++;
+        }
+      else
+        {
+          fprintf (stderr, "Error, unknown option %s\n", argv[1]);
+          exit (1);
+        }
+    }
+
+  printf ("Checking special values\n");
+  check_special ();
+  printf ("Checking powers of 2\n");
+  check_powers_of_two ();
+  printf ("Checking exact values\n");
+  check_exact ();
+  printf ("Checking random values\n");
+  check_random_all ();
+  printf ("%ld tests passed\n", tests);
+
+  return 0;
+}
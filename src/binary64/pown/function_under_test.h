@@ -0,0 +1,10 @@
+#include <inttypes.h>
+
+#define cr_function_under_test cr_pown
+#define ref_function_under_test ref_pown
+
+#define TYPE_Y int64_t // the exponent n
+#define SCN_Y SCNd64
+#define PRI_Y PRId64
+
+#define WORST_SYMMETRIC_X // test x and -x
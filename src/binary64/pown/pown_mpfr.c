@@ -0,0 +1,46 @@
+/* Correctly-rounded power of a binary64 value to an integer exponent.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <stdint.h> /* before mpfr.h, for mpfr_pow_sj */
+#include <mpfr.h>
+#include "fenv_mpfr.h"
+
+typedef union { double f; uint64_t u; } b64u64_u;
+
+/* reference code using MPFR */
+double ref_pown(double x, int64_t n) {
+  b64u64_u v = {.f = x};
+  /* pown(x,0) is 1 for a quiet NaN x, but a signaling NaN gives a quiet NaN
+     (IEEE 754-2019, Section 9.2.1), which MPFR does not distinguish */
+  if (n == 0 && (v.u << 1) > 0xffeull << 52 && !((v.u >> 51) & 1))
+    return x + x;
+  mpfr_t z, _x;
+  mpfr_inits2(53, z, _x, NULL);
+  mpfr_set_d(_x, x, MPFR_RNDN);
+  int inex = mpfr_pow_sj(z, _x, n, rnd2[rnd]);
+  mpfr_subnormalize(z, inex, rnd2[rnd]);
+  double ret = mpfr_get_d(z, rnd2[rnd]);
+  mpfr_clears(z, _x, NULL);
+  return ret;
+}
@@ -0,0 +1,233 @@
+/* Correctly-rounded sine and cosine functions for binary64 value.
+
+Copyright (c) 2022-2023 Paul Zimmermann and Tom Hubrecht
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// This code has been adapted to C++ and MSVC.
+
+#include "core-math/sincos.h"
+#include "core-math/stats.h"
+
+/* stdio.h and stdlib.h are needed in case the rounding test of the accurate
+   step fails, to print the corresponding input and exit. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <fenv.h>
+
+#include <bit>
+#include <cmath>
+
+#include "absl/numeric/int128.h"
+
+// Warning: clang also defines __GNUC__
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#endif
+
+#if !defined(CORE_MATH_ROUNDING) || CORE_MATH_ROUNDING != FE_TONEAREST
+#pragma STDC FENV_ACCESS ON
+#endif
+
+#if defined(_MSC_VER)
+#ifndef __builtin_clzl
+#define __builtin_clzl(x) std::countl_zero(x)
+#endif
+#ifndef __builtin_fma
+#define __builtin_fma(x, y, z) std::fma(x, y, z)
+#endif
+#ifndef __builtin_expect
+#define __builtin_expect(x, y) x
+#endif
+#ifndef __builtin_fabs
+#define __builtin_fabs(x) std::abs(x)
+#endif
+#ifndef __builtin_floor
+#define __builtin_floor(x) std::floor(x)
+#endif
+#endif
+
+// the accurate paths of cr_sincos count as those of sincos
+#define SIN_ACCURATE_STATS SINCOS
+#define COS_ACCURATE_STATS SINCOS
+#include "../support/sincos_common.h"
+
+/* Assume x is a regular number and x > 0x1.6a09e667f3bccp-27.
+   Put in sh+sl and ch+cl approximations of sin(x) and cos(x), sharing
+   the argument reduction, the SC[] lookup and the polynomial evaluations,
+   and return in serr and cerr bounds on the maximal absolute errors:
+   | sh + sl - sin(x) | < serr and | ch + cl - cos(x) | < cerr */
+static void
+sincos_fast (double *sh, double *sl, double *ch, double *cl,
+             double *serr, double *cerr, double x)
+{
+  int sin_neg = 0, cos_neg = 0, is_sin = 1;
+
+  double err1, h, l;
+  int i = reduce_fast (&h, &l, x, &err1);
+  /* err1 is an absolute bound for | i/2^11 + h + l - frac(x/(2pi)) |:
+     | i/2^11 + h + l - frac(x/(2pi)) | < err1 */
+
+  // if i >= 2^10: 1/2 <= frac(x/(2pi)) < 1 thus pi <= x <= 2pi
+  // we use sin(pi+x) = -sin(x) and cos(pi+x) = -cos(x)
+  sin_neg = sin_neg ^ (i >> 10);
+  cos_neg = cos_neg ^ (i >> 10);
+  i = i & 0x3ff;
+
+  // now i < 2^10
+  // if i >= 2^9: 1/4 <= frac(x/(2pi)) < 1/2 thus pi/2 <= x <= pi
+  // we use sin(pi/2+x) = cos(x) and cos(pi/2+x) = -sin(x)
+  is_sin = is_sin ^ (i >> 9);
+  cos_neg = cos_neg ^ (i >> 9);
+  i = i & 0x1ff;
+
+  // now 0 <= i < 2^9
+  // if i >= 2^8: 1/8 <= frac(x/(2pi)) < 1/4
+  // we use sin(pi/2-x) = cos(x) and cos(pi/2-x) = sin(x)
+  if (i & 0x100) // case pi/4 <= x_red <= pi/2
+    {
+      is_sin = !is_sin;
+      i = 0x1ff - i;
+      // 0x1p-11 - h is exact, see sin_fast() in sin.c
+      h = 0x1p-11 - h;
+      l = -l;
+    }
+
+  /* Now 0 <= i < 256 and 0 <= h+l < 2^-11
+     with | i/2^11 + h + l - frac(x/(2pi)) | cmod 1/4 < err1
+     If is_sin=1, sin(x) = sin2pi (R + err1) and cos(x) = cos2pi (R + err1);
+     if is_sin=0, sin(x) = cos2pi (R + err1) and cos(x) = sin2pi (R + err1),
+     up to the signs sin_neg and cos_neg.
+     In both cases R = i/2^11 + h + l, 0 <= R < 1/4.
+  */
+  double ph, pl, qh, ql;
+  // h-SC[i][0] is exact, see sin_fast() in sin.c
+  h -= SC[i][0];
+  // now -2^-24 < h < 2^-11+2^-24
+  // from reduce_fast() we have |l| < 2^-52.36
+  double uh, ul;
+  a_mul (&uh, &ul, h, h);
+  ul = __builtin_fma (h + h, l, ul);
+  // uh+ul approximates (h+l)^2
+  evalPSfast (&ph, &pl, h, l, uh, ul);
+  // | ph + pl - sin2pi(h+l) | < 2^-77.09
+  evalPCfast (&qh, &ql, uh, ul);
+  // | qh + ql - cos2pi(h+l) | < 2^-69.96 * |qh + ql|
+
+  double ah, al, bh, bl, s2h, s2l, c2h, c2l;
+  // sin2pi(R) ~ sin2pi(i/2^11)*cos2pi(h+l)+cos2pi(i/2^11)*sin2pi(h+l)
+  s_mul (&ah, &al, SC[i][2], ph, pl);
+  s_mul (&bh, &bl, SC[i][1], qh, ql);
+  fast_two_sum (&s2h, &s2l, bh, ah);
+  s2l += al + bl;
+  // | s2h + s2l - sin2pi (R) | < 2^-68.588, see sin_fast() in sin.c
+  // cos2pi(R) ~ cos2pi(i/2^11)*cos2pi(h+l)-sin2pi(i/2^11)*sin2pi(h+l)
+  s_mul (&ah, &al, SC[i][2], qh, ql);
+  s_mul (&bh, &bl, SC[i][1], ph, pl);
+  fast_two_sum (&c2h, &c2l, ah, -bh);
+  c2l += al - bl;
+  // | c2h + c2l - cos2pi (R) | < 2^-68.414, see sin_fast() in sin.c
+
+  static const double sgn[2] = {1.0, -1.0};
+  if (is_sin)
+    {
+      *sh = s2h * sgn[sin_neg];
+      *sl = s2l * sgn[sin_neg];
+      *serr = 0x1.55p-69 + err1;
+      *ch = c2h * sgn[cos_neg];
+      *cl = c2l * sgn[cos_neg];
+      *cerr = 0x1.81p-69 + err1;
+    }
+  else
+    {
+      *sh = c2h * sgn[sin_neg];
+      *sl = c2l * sgn[sin_neg];
+      *serr = 0x1.81p-69 + err1;
+      *ch = s2h * sgn[cos_neg];
+      *cl = s2l * sgn[cos_neg];
+      *cerr = 0x1.55p-69 + err1;
+    }
+}
+
+void __cdecl
+cr_sincos (double x, double *s, double *c)
+{
+  CORE_MATH_STATS_ADD (SINCOS, calls, 2);
+  b64u64_u t = {.f = x};
+  int e = (t.u >> 52) & 0x7ff;
+
+  if (__builtin_expect (e == 0x7ff, 0)) /* NaN, +Inf and -Inf. */
+    {
+      t.u = ~0ull;
+      *s = *c = t.f;
+      return;
+    }
+
+  /* now x is a regular number */
+
+  /* For |x| <= 0x1.7137449123ef6p-26, sin(x) rounds to x (to nearest),
+     and for |x| <= 0x1.6a09e667f3bccp-27, cos(x) rounds to 1 (to nearest),
+     see cr_sin() in sin.c and cr_cos() in cos.c. */
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+  t.u = ux;
+  if (__builtin_expect (ux <= 0x3e46a09e667f3bcc, 0))
+    {
+      // for x=-0, fma (x, -0x1p-54, x) returns +0
+      *s = (x == 0) ? x : __builtin_fma (x, -0x1p-54, x);
+      *c = __builtin_fma (t.f, -0x1p-28, 1.0);
+      return;
+    }
+
+  double sh, sl, ch, cl, serr, cerr;
+  sincos_fast (&sh, &sl, &ch, &cl, &serr, &cerr, t.f);
+  if (x < 0)
+    {
+      sh = -sh;
+      sl = -sl;
+    }
+
+  // 0x3e57137449123ef6 = 0x1.7137449123ef6p-26
+  if (ux <= 0x3e57137449123ef6)
+    *s = __builtin_fma (x, -0x1p-54, x);
+  else
+    {
+      double left  = sh + (sl - serr), right = sh + (sl + serr);
+      if (__builtin_expect (left == right, 1))
+        {
+          CORE_MATH_STATS_COUNT (SINCOS, fast);
+          *s = left;
+        }
+      else
+        *s = sin_accurate (x);
+    }
+
+  double left  = ch + (cl - cerr), right = ch + (cl + cerr);
+  if (__builtin_expect (left == right, 1))
+    {
+      CORE_MATH_STATS_COUNT (SINCOS, fast);
+      *c = left;
+    }
+  else
+    *c = cos_accurate (t.f);
+}
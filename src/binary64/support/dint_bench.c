@@ -0,0 +1,192 @@
+/* Micro-benchmark of the dint64_t primitives of dint64.h.
+
+Copyright (c) 2022-2023 Paul Zimmermann and Tom Hubrecht
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* Build with "make dint-bench" from the top-level directory, then run
+   src/binary64/support/dint_bench [N].  For each primitive, the first
+   column gives the latency (each call depends on the previous result) and
+   the second one the reciprocal throughput (independent calls), both in
+   nanoseconds per call. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "dint64.h"
+
+#define LANES 8
+
+static double
+now (void)
+{
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return (double) t.tv_sec + 1e-9 * (double) t.tv_nsec;
+}
+
+static uint64_t
+rnd (uint64_t *s)
+{
+  // xorshift64
+  *s ^= *s << 13;
+  *s ^= *s >> 7;
+  *s ^= *s << 17;
+  return *s;
+}
+
+// a random dint64_t in [1/2,1) (times 2^e with |e| <= 3)
+static void
+rnd_dint (dint64_t *a, uint64_t *s)
+{
+  a->hi = rnd (s) | (1ull << 63);
+  a->lo = rnd (s);
+  a->ex = (int64_t) (rnd (s) % 7) - 3;
+  a->sgn = rnd (s) & 1;
+}
+
+/* Prevent the compiler from hoisting or discarding the computation of *a:
+   the empty asm statement may read and modify it. */
+static inline void
+opaque (dint64_t *a)
+{
+  __asm__ volatile ("" : : "r" (a) : "memory");
+}
+
+static volatile double sink;
+
+static void
+report (const char *name, double lat, double thr, long n)
+{
+  if (lat > 0)
+    printf ("%-12s %8.2f", name, 1e9 * lat / (double) n);
+  else
+    printf ("%-12s %8s", name, "-");
+  printf (" %8.2f\n", 1e9 * thr / (double) (n * LANES));
+}
+
+int
+main (int argc, char *argv[])
+{
+  long n = (argc > 1) ? atol (argv[1]) : 10000000;
+  uint64_t s = 0x2545f4914f6cdd1d;
+  dint64_t a[LANES], b[LANES], r;
+  double x[LANES], t0, lat, thr;
+
+  for (int j = 0; j < LANES; j++)
+  {
+    rnd_dint (a + j, &s);
+    rnd_dint (b + j, &s);
+    x[j] = (double) (rnd (&s) >> 11) * 0x1p-40;
+  }
+
+  printf ("%-12s %8s %8s\n", "ns/call", "latency", "thrput");
+
+  /* In the latency loops, the exponent of the result is reset so that it
+     stays in range: this adds a store but no dependency on the primitive. */
+  cp_dint (&r, a);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+  {
+    mul_dint (&r, &r, b + (i & (LANES - 1)));
+    r.ex = 0;
+  }
+  lat = now () - t0;
+  opaque (&r);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+    for (int j = 0; j < LANES; j++)
+    {
+      mul_dint (&r, a + j, b + j);
+      opaque (&r);
+    }
+  thr = now () - t0;
+  report ("mul_dint", lat, thr, n);
+
+  cp_dint (&r, a);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+  {
+    mul_dint_21 (&r, &r, b + (i & (LANES - 1)));
+    r.ex = 0;
+  }
+  lat = now () - t0;
+  opaque (&r);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+    for (int j = 0; j < LANES; j++)
+    {
+      mul_dint_21 (&r, a + j, b + j);
+      opaque (&r);
+    }
+  thr = now () - t0;
+  report ("mul_dint_21", lat, thr, n);
+
+  /* The operands of add_dint alternate in sign and magnitude, thus both
+     the addition and the subtraction paths are exercised. */
+  cp_dint (&r, a);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+  {
+    add_dint (&r, &r, b + (i & (LANES - 1)));
+    r.ex = 0;
+  }
+  lat = now () - t0;
+  opaque (&r);
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+    for (int j = 0; j < LANES; j++)
+    {
+      add_dint (&r, a + j, b + j);
+      opaque (&r);
+    }
+  thr = now () - t0;
+  report ("add_dint", lat, thr, n);
+
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+    for (int j = 0; j < LANES; j++)
+    {
+      dint_fromd (&r, x[j]);
+      opaque (&r);
+    }
+  thr = now () - t0;
+  report ("dint_fromd", 0.0, thr, n);
+
+  double acc = 0;
+  t0 = now ();
+  for (long i = 0; i < n; i++)
+    for (int j = 0; j < LANES; j++)
+    {
+      cp_dint (&r, a + j);
+      opaque (&r);
+      acc += dint_tod (&r);
+    }
+  thr = now () - t0;
+  report ("dint_tod", 0.0, thr, n);
+  sink = acc;
+
+  return 0;
+}
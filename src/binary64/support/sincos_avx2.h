@@ -0,0 +1,192 @@
+/* AVX2 fast path of cr_sin_n and cr_cos_n.
+
+Copyright (c) 2022-2023 Paul Zimmermann and Tom Hubrecht
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+  This file contains the kernel of cr_sin_n() and cr_cos_n(), which
+  evaluates sin_fast() or cos_fast() on 4 arguments at once.  It is included
+  after sincos_common.h, when __AVX2__ and __FMA__ are defined.
+*/
+
+#ifndef SINCOS_AVX2_H
+#define SINCOS_AVX2_H
+
+#include <stdint.h>
+
+#include <immintrin.h>
+
+#include "sincos_common.h"
+
+/* Number of arguments evaluated together by cr_sin_n() and cr_cos_n(). */
+#define SINCOS_N_LANES 8
+
+/* The encodings of the largest |x| for which cr_sin and cr_cos do not use
+   their fast path: 0x3e57137449123ef6 = 0x1.7137449123ef6p-26 for sin,
+   0x3e46a09e667f3bcc = 0x1.6a09e667f3bccp-27 for cos. */
+static const uint64_t sincos_lane_min[2] = {
+  0x3e57137449123ef6, 0x3e46a09e667f3bcc};
+
+/* Return non-zero iff sincos_lane_min[is_cos] < |x| <= 0x1.921fb54442d17p+2,
+   i.e., |x| is handled by the first branch of reduce_fast() in sin_fast()
+   (is_cos=0) or cos_fast() (is_cos=1). */
+static inline int
+sincos_lane_domain (double x, int is_cos)
+{
+  b64u64_u t = {.f = x};
+  uint64_t ux = t.u & 0x7fffffffffffffff;
+  // 0x401921fb54442d17 = 0x1.921fb54442d17p+2
+  return sincos_lane_min[is_cos] < ux && ux <= 0x401921fb54442d17;
+}
+
+/* Same as sin_fast() (is_cos=0) or cos_fast() (is_cos=1) followed by the
+   rounding test of cr_sin() or cr_cos(), on the 4 lanes of x.  The control
+   flow is replaced by selections between lanes and the SC[] accesses by
+   gathers.  The operations are those of sin_fast() and cos_fast(), in the
+   same order, thus each lane of y is bit-identical to cr_sin(x) or cr_cos(x)
+   when the rounding test succeeds.  The two functions only differ by the
+   quadrant: is_cos selects which of the columns SC[i][1] and SC[i][2], thus
+   which of the polynomials PSfast[] and PCfast[], gives the leading term,
+   and the sign of the result.  is_cos must be a constant.
+   Return the mask of the lanes which are in the domain of
+   sincos_lane_domain() and for which the rounding test succeeds. */
+static inline unsigned
+sincos_fast_avx2 (double *y, __m256d x, int is_cos)
+{
+  const __m256d sign = _mm256_set1_pd (-0.0);
+  __m256i ux = _mm256_castpd_si256 (_mm256_andnot_pd (sign, x));
+  __m256i in = _mm256_andnot_si256 (
+    _mm256_cmpgt_epi64 (ux, _mm256_set1_epi64x (0x401921fb54442d17)),
+    _mm256_cmpgt_epi64 (ux, _mm256_set1_epi64x (sincos_lane_min[is_cos])));
+  // 1 is a dummy argument for the lanes outside the domain
+  x = _mm256_blendv_pd (_mm256_set1_pd (1.0), x, _mm256_castsi256_pd (in));
+  // sin(-x) = -sin(x) and cos(-x) = cos(x)
+  __m256d neg = is_cos ? _mm256_setzero_pd () : _mm256_and_pd (sign, x);
+  __m256d absx = _mm256_andnot_pd (sign, x);
+
+  // reduce_fast()
+  __m256d h = _mm256_mul_pd (_mm256_set1_pd (CH), absx);
+  __m256d l = _mm256_fmsub_pd (_mm256_set1_pd (CH), absx, h);
+  l = _mm256_fmadd_pd (_mm256_set1_pd (CL), absx, l);
+  __m256d err1 = _mm256_mul_pd (_mm256_set1_pd (0x1.d9p-105), h);
+  __m256d fi = _mm256_floor_pd (_mm256_mul_pd (h, _mm256_set1_pd (0x1p11)));
+  h = _mm256_fmadd_pd (fi, _mm256_set1_pd (-0x1p-11), h);
+  __m128i i = _mm256_cvttpd_epi32 (fi);
+
+  // sin_fast() or cos_fast()
+  __m128i b10 = _mm_srli_epi32 (i, 10);
+  i = _mm_and_si128 (i, _mm_set1_epi32 (0x3ff));
+  __m128i b9 = _mm_srli_epi32 (i, 9);
+  i = _mm_and_si128 (i, _mm_set1_epi32 (0x1ff));
+  __m128i flip = _mm_srli_epi32 (i, 8);
+  __m128i is_sin = _mm_xor_si128 (_mm_set1_epi32 (!is_cos),
+                                  _mm_xor_si128 (b9, flip));
+  // 0x1ff - i = 0x1ff ^ i since 0 <= i <= 0x1ff
+  flip = _mm_sub_epi32 (_mm_setzero_si128 (), flip);
+  i = _mm_xor_si128 (i, _mm_and_si128 (flip, _mm_set1_epi32 (0x1ff)));
+  __m256d flip_mask = _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (flip));
+  __m256d sin_mask = _mm256_castsi256_pd (_mm256_cvtepi32_epi64 (
+    _mm_sub_epi32 (_mm_setzero_si128 (), is_sin)));
+  // sin(pi+x) = -sin(x), cos(pi+x) = -cos(x) and cos(pi/2+x) = -sin(x)
+  __m128i nb = is_cos ? _mm_xor_si128 (b10, b9) : b10;
+  neg = _mm256_xor_pd (neg, _mm256_castsi256_pd (_mm256_slli_epi64 (
+    _mm256_cvtepi32_epi64 (nb), 63)));
+  h = _mm256_blendv_pd (h, _mm256_sub_pd (_mm256_set1_pd (0x1p-11), h),
+                        flip_mask);
+  l = _mm256_xor_pd (l, _mm256_and_pd (flip_mask, sign));
+
+  __m128i k = _mm_add_epi32 (i, _mm_add_epi32 (i, i)); // 3*i
+  __m256d sc0 = _mm256_i32gather_pd (&SC[0][0], k, 8);
+  __m256d sc1 = _mm256_i32gather_pd (&SC[0][1], k, 8);
+  __m256d sc2 = _mm256_i32gather_pd (&SC[0][2], k, 8);
+  h = _mm256_sub_pd (h, sc0);
+  __m256d uh = _mm256_mul_pd (h, h);
+  __m256d ul = _mm256_fmsub_pd (h, h, uh);
+  ul = _mm256_fmadd_pd (_mm256_add_pd (h, h), l, ul);
+
+  // evalPSfast()
+  __m256d sh, sl, ch, cl, t, e;
+  sh = _mm256_set1_pd (PSfast[4]);
+  sh = _mm256_fmadd_pd (sh, uh, _mm256_set1_pd (PSfast[3]));
+  sh = _mm256_fmadd_pd (sh, uh, _mm256_set1_pd (PSfast[2]));
+  t = _mm256_mul_pd (sh, uh);
+  sl = _mm256_fmsub_pd (sh, uh, t);
+  sl = _mm256_fmadd_pd (sh, ul, sl);
+  sh = _mm256_add_pd (_mm256_set1_pd (PSfast[0]), t);
+  e = _mm256_sub_pd (sh, _mm256_set1_pd (PSfast[0]));
+  t = _mm256_sub_pd (t, e);
+  sl = _mm256_add_pd (sl, _mm256_add_pd (_mm256_set1_pd (PSfast[1]), t));
+  t = _mm256_mul_pd (sh, h);
+  e = _mm256_fmsub_pd (sh, h, t);
+  e = _mm256_fmadd_pd (sl, h, e);
+  sl = _mm256_fmadd_pd (sh, l, e);
+  sh = t;
+
+  // evalPCfast()
+  ch = _mm256_set1_pd (PCfast[4]);
+  ch = _mm256_fmadd_pd (ch, uh, _mm256_set1_pd (PCfast[3]));
+  ch = _mm256_fmadd_pd (ch, uh, _mm256_set1_pd (PCfast[2]));
+  t = _mm256_mul_pd (ch, uh);
+  cl = _mm256_fmsub_pd (ch, uh, t);
+  cl = _mm256_fmadd_pd (ch, ul, cl);
+  ch = _mm256_add_pd (_mm256_set1_pd (PCfast[0]), t);
+  e = _mm256_sub_pd (ch, _mm256_set1_pd (PCfast[0]));
+  t = _mm256_sub_pd (t, e);
+  cl = _mm256_add_pd (cl, _mm256_add_pd (_mm256_set1_pd (PCfast[1]), t));
+
+  /* If is_sin=1, sin2pi(R) = SC[i][1]*cos2pi(h+l) + SC[i][2]*sin2pi(h+l),
+     otherwise cos2pi(R) = SC[i][2]*cos2pi(h+l) - SC[i][1]*sin2pi(h+l). */
+  __m256d ah, al, bh, bl, uh2, ul2, vh, vl;
+  uh2 = _mm256_blendv_pd (ch, sh, sin_mask);
+  ul2 = _mm256_blendv_pd (cl, sl, sin_mask);
+  vh = _mm256_blendv_pd (sh, ch, sin_mask);
+  vl = _mm256_blendv_pd (sl, cl, sin_mask);
+  ah = _mm256_mul_pd (sc2, uh2);
+  al = _mm256_fmsub_pd (sc2, uh2, ah);
+  al = _mm256_fmadd_pd (sc2, ul2, al);
+  bh = _mm256_mul_pd (sc1, vh);
+  bl = _mm256_fmsub_pd (sc1, vh, bh);
+  bl = _mm256_fmadd_pd (sc1, vl, bl);
+  __m256d not_sin_sign = _mm256_andnot_pd (sin_mask, sign);
+  __m256d a = _mm256_blendv_pd (ah, bh, sin_mask);
+  __m256d b = _mm256_blendv_pd (_mm256_xor_pd (bh, not_sin_sign), ah,
+                                sin_mask);
+  h = _mm256_add_pd (a, b);
+  e = _mm256_sub_pd (h, a);
+  l = _mm256_sub_pd (b, e);
+  l = _mm256_add_pd (l, _mm256_add_pd (al, _mm256_xor_pd (bl, not_sin_sign)));
+  __m256d err = _mm256_blendv_pd (_mm256_set1_pd (0x1.81p-69),
+                                  _mm256_set1_pd (0x1.55p-69), sin_mask);
+  err = _mm256_add_pd (err, err1);
+  h = _mm256_xor_pd (h, neg);
+  l = _mm256_xor_pd (l, neg);
+  __m256d left = _mm256_add_pd (h, _mm256_sub_pd (l, err));
+  __m256d right = _mm256_add_pd (h, _mm256_add_pd (l, err));
+  _mm256_storeu_pd (y, left);
+  __m256d ok = _mm256_and_pd (_mm256_cmp_pd (left, right, _CMP_EQ_OQ),
+                              _mm256_castsi256_pd (in));
+  return _mm256_movemask_pd (ok);
+}
+
+#endif
@@ -0,0 +1,154 @@
+/* Run-time selection of the micro-architecture variant of each function.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* On x86-64 the Makefile compiles each translation unit of the library for
+   the x86-64, x86-64-v3 and x86-64-v4 micro-architecture levels, with each
+   function cr_f_<mode> for a rounding mode renamed cr_f_<mode>_x86_64,
+   cr_f_<mode>_x86_64_v3 and cr_f_<mode>_x86_64_v4.  This file defines
+   cr_f_<mode>, which forwards to the variant for the processor it runs on.
+   The variant is selected on the first call of each function, so that the
+   selection does not depend on the order of static initialization.
+
+   All the functions of the library translation units have internal linkage
+   (apart from the renamed entry points), thus no code compiled for a higher
+   level can be reached from a lower-level variant. */
+
+#include <cpuid.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "core-math/acos.h"
+#include "core-math/asin.h"
+#include "core-math/atan2.h"
+#include "core-math/cbrt.h"
+#include "core-math/cos.h"
+#include "core-math/exp.h"
+#include "core-math/hypot.h"
+#include "core-math/log.h"
+#include "core-math/pow.h"
+#include "core-math/sin.h"
+#include "core-math/sincos.h"
+#include "core-math/tan.h"
+
+// Return the value of the extended control register XCR0.
+static uint64_t
+xgetbv0 (void)
+{
+  uint32_t lo, hi;
+  __asm__ ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+  return ((uint64_t) hi << 32) | lo;
+}
+
+/* Return 2 if the processor supports x86-64-v4, 1 if it supports x86-64-v3,
+   and 0 otherwise (x86-64). */
+static int
+detect_level (void)
+{
+  unsigned int a, b, c, d;
+  // x86-64-v3
+  const unsigned int v3_c1 = bit_FMA | bit_MOVBE | bit_OSXSAVE | bit_AVX
+                             | bit_F16C;
+  const unsigned int v3_b7 = bit_AVX2 | bit_BMI | bit_BMI2;
+  if (!__get_cpuid (1, &a, &b, &c, &d) || (c & v3_c1) != v3_c1)
+    return 0;
+  uint64_t xcr0 = xgetbv0 ();
+  if ((xcr0 & 0x6) != 0x6) // XMM and YMM state enabled by the OS
+    return 0;
+  if (!__get_cpuid_count (7, 0, &a, &b, &c, &d) || (b & v3_b7) != v3_b7)
+    return 0;
+  unsigned int b7 = b;
+  if (!__get_cpuid (0x80000001, &a, &b, &c, &d) || !(c & bit_LZCNT))
+    return 0;
+  // x86-64-v4
+  const unsigned int v4_b7 = bit_AVX512F | bit_AVX512DQ | bit_AVX512CD
+                             | bit_AVX512BW | bit_AVX512VL;
+  if ((b7 & v4_b7) != v4_b7)
+    return 1;
+  if ((xcr0 & 0xe0) != 0xe0) // opmask and ZMM state enabled by the OS
+    return 1;
+  return 2;
+}
+
+static int
+level (void)
+{
+  static const int l = detect_level ();
+  return l;
+}
+
+/* Define cr_f forwarding to the variant selected by level().  The first
+   call goes through f_resolve, which replaces itself by the variant. */
+#define CORE_MATH_DISPATCH_LEVEL(type, f, params, args)                  \
+  type __cdecl cr_##f##_x86_64 params;                                   \
+  type __cdecl cr_##f##_x86_64_v3 params;                                \
+  type __cdecl cr_##f##_x86_64_v4 params;                                \
+  static type __cdecl f##_resolve params;                                \
+  static std::atomic<type (__cdecl *) params> f##_impl{&f##_resolve};    \
+  static type __cdecl f##_resolve params                                 \
+  {                                                                      \
+    static type (__cdecl *const variants[]) params = {                   \
+      &cr_##f##_x86_64, &cr_##f##_x86_64_v3, &cr_##f##_x86_64_v4};       \
+    f##_impl.store (variants[level ()], std::memory_order_relaxed);      \
+    return variants[level ()] args;                                      \
+  }                                                                      \
+  type __cdecl cr_##f params                                             \
+  {                                                                      \
+    return f##_impl.load (std::memory_order_relaxed) args;               \
+  }
+
+/* Each variant of cr_f for a rounding mode (see src/dispatch/rounding.c),
+   and the variant cr_f_rn_nse without side effects, is itself
+   dispatched. */
+#define CORE_MATH_DISPATCH(type, f, params, args)                        \
+  CORE_MATH_DISPATCH_LEVEL (type, f##_rn, params, args)                  \
+  CORE_MATH_DISPATCH_LEVEL (type, f##_rd, params, args)                  \
+  CORE_MATH_DISPATCH_LEVEL (type, f##_ru, params, args)                  \
+  CORE_MATH_DISPATCH_LEVEL (type, f##_rz, params, args)                  \
+  CORE_MATH_DISPATCH_LEVEL (type, f##_rn_nse, params, args)
+
+CORE_MATH_DISPATCH (double, acos, (double x), (x))
+CORE_MATH_DISPATCH (double, asin, (double x), (x))
+CORE_MATH_DISPATCH (double, atan2, (double y, double x), (y, x))
+CORE_MATH_DISPATCH (double, cbrt, (double x), (x))
+CORE_MATH_DISPATCH (double, cos, (double x), (x))
+CORE_MATH_DISPATCH (double, cos_accurate, (double x), (x))
+CORE_MATH_DISPATCH (void, cos_n, (const double *x, double *y, size_t n),
+                    (x, y, n))
+CORE_MATH_DISPATCH (double, exp, (double x), (x))
+CORE_MATH_DISPATCH (double, exp_accurate, (double x), (x))
+CORE_MATH_DISPATCH (double, hypot, (double x, double y), (x, y))
+CORE_MATH_DISPATCH (double, log, (double x), (x))
+CORE_MATH_DISPATCH (double, log_accurate, (double x), (x))
+CORE_MATH_DISPATCH (double, pow, (double x, double y), (x, y))
+CORE_MATH_DISPATCH (void, pow_n, (const double *x, double y, double *r, size_t n),
+                    (x, y, r, n))
+CORE_MATH_DISPATCH (double, pown, (double x, int64_t n), (x, n))
+CORE_MATH_DISPATCH (double, sin, (double x), (x))
+CORE_MATH_DISPATCH (double, sin_accurate, (double x), (x))
+CORE_MATH_DISPATCH (void, sin_n, (const double *x, double *y, size_t n),
+                    (x, y, n))
+CORE_MATH_DISPATCH (void, sincos, (double x, double *s, double *c),
+                    (x, s, c))
+CORE_MATH_DISPATCH (double, tan, (double x), (x))
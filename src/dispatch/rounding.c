@@ -0,0 +1,122 @@
+/* Run-time selection of the rounding-mode variant of each function.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The Makefile compiles each translation unit of the library once per
+   rounding mode, with CORE_MATH_ROUNDING defined and each function cr_f
+   renamed cr_f_rn (rounding to nearest), cr_f_rd (downward), cr_f_ru
+   (upward) or cr_f_rz (toward zero).  Each variant is only correct when
+   called in its rounding mode.  This file defines cr_f, which reads the
+   current rounding mode and calls the corresponding variant. */
+
+#include <fenv.h>
+#include <stddef.h>
+
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
+
+#include "core-math/acos.h"
+#include "core-math/asin.h"
+#include "core-math/atan2.h"
+#include "core-math/cbrt.h"
+#include "core-math/cos.h"
+#include "core-math/exp.h"
+#include "core-math/hypot.h"
+#include "core-math/log.h"
+#include "core-math/pow.h"
+#include "core-math/sin.h"
+#include "core-math/sincos.h"
+#include "core-math/tan.h"
+
+/* Return 0 when rounding to nearest, 1 downward, 2 upward and 3 toward
+   zero.  On x86-64, the SSE rounding mode is read from MXCSR, which is
+   cheaper than fegetround() (glibc reads the x87 control word). */
+static inline int
+rounding_mode (void)
+{
+#ifdef __x86_64__
+  return (_mm_getcsr () >> 13) & 3;
+#else
+  switch (fegetround ())
+  {
+  case FE_TONEAREST:
+    return 0;
+  case FE_DOWNWARD:
+    return 1;
+  case FE_UPWARD:
+    return 2;
+  }
+  // case FE_TOWARDZERO:
+  return 3;
+#endif
+}
+
+/* Define cr_f calling cr_f_rn, cr_f_rd, cr_f_ru or cr_f_rz.  The variants
+   not declared in the public headers are declared here. */
+#define CORE_MATH_ROUNDING_DISPATCH(type, f, params, args)               \
+  type __cdecl cr_##f##_rn params;                                       \
+  type __cdecl cr_##f##_rd params;                                       \
+  type __cdecl cr_##f##_ru params;                                       \
+  type __cdecl cr_##f##_rz params;                                       \
+  type __cdecl cr_##f params                                             \
+  {                                                                      \
+    switch (rounding_mode ())                                            \
+    {                                                                    \
+    case 0:                                                              \
+      return cr_##f##_rn args;                                           \
+    case 1:                                                              \
+      return cr_##f##_rd args;                                           \
+    case 2:                                                              \
+      return cr_##f##_ru args;                                           \
+    }                                                                    \
+    return cr_##f##_rz args;                                             \
+  }
+
+CORE_MATH_ROUNDING_DISPATCH (double, acos, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, asin, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, atan2, (double y, double x), (y, x))
+CORE_MATH_ROUNDING_DISPATCH (double, cbrt, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, cos, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, cos_accurate, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (void, cos_n,
+                             (const double *x, double *y, size_t n),
+                             (x, y, n))
+CORE_MATH_ROUNDING_DISPATCH (double, exp, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, exp_accurate, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, hypot, (double x, double y), (x, y))
+CORE_MATH_ROUNDING_DISPATCH (double, log, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, log_accurate, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, pow, (double x, double y), (x, y))
+CORE_MATH_ROUNDING_DISPATCH (void, pow_n,
+                             (const double *x, double y, double *r, size_t n),
+                             (x, y, r, n))
+CORE_MATH_ROUNDING_DISPATCH (double, pown, (double x, int64_t n), (x, n))
+CORE_MATH_ROUNDING_DISPATCH (double, sin, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (double, sin_accurate, (double x), (x))
+CORE_MATH_ROUNDING_DISPATCH (void, sin_n,
+                             (const double *x, double *y, size_t n),
+                             (x, y, n))
+CORE_MATH_ROUNDING_DISPATCH (void, sincos, (double x, double *s, double *c),
+                             (x, s, c))
+CORE_MATH_ROUNDING_DISPATCH (double, tan, (double x), (x))
@@ -0,0 +1,53 @@
+/* C linkage for a function under test written in C++.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The functions of the library are compiled as C++, thus their symbols are
+   mangled, while the check and perf programs are C.  This file is compiled
+   with $(CXX), with CXX_FUNCTION the name given to the function in its
+   source (cr_f renamed cr_f_cxx, see Makefile.checkstd) and C_FUNCTION the
+   name under which the C programs call it (cr_f), and TYPE_UNDER_TEST and
+   BIVARIATE as for the function.  PARAMS and ARGS may be defined instead
+   for other signatures. */
+
+#include <stdint.h>
+
+#ifndef PARAMS
+#ifdef BIVARIATE
+#define PARAMS (TYPE_UNDER_TEST x, TYPE_UNDER_TEST y)
+#define ARGS (x, y)
+#else
+#define PARAMS (TYPE_UNDER_TEST x)
+#define ARGS (x)
+#endif
+#endif
+
+TYPE_UNDER_TEST CXX_FUNCTION PARAMS;
+
+extern "C" TYPE_UNDER_TEST C_FUNCTION PARAMS;
+
+TYPE_UNDER_TEST
+C_FUNCTION PARAMS
+{
+  return CXX_FUNCTION ARGS;
+}
@@ -0,0 +1,201 @@
+/* Progress reports for the parallel loops of the check programs.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The cost of one check varies a lot between inputs (fast path, accurate
+   path, MPFR on hard cases), thus the check loops use a dynamic schedule,
+   and report their progress as follows:
+
+     check_loop_begin (total, "name");
+   #pragma omp parallel for schedule(dynamic,check_loop_chunk)
+     for (...)
+     {
+       check_loop_step ();
+       ...
+     }
+     check_loop_end ();
+
+   where total is the number of iterations.  From it, check_loop_begin
+   derives the size check_loop_chunk of the chunks handed out to the
+   threads: at most CHECK_LOOP_CHUNK iterations, but small enough for each
+   thread to get many chunks.  Each thread counts its own iterations; every
+   CHECK_LOOP_POLL of them, it looks at the clock, and every
+   CORE_MATH_PROGRESS seconds (by default 10 when stderr is a terminal,
+   otherwise no report), the number of iterations done, the throughput and
+   the estimated remaining time are printed on stderr. */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#define CHECK_LOOP_CHUNK 1024
+#define CHECK_LOOP_POLL 1024
+
+static int check_loop_chunk = CHECK_LOOP_CHUNK;
+
+// one cache line per thread, so that the counters are not shared
+typedef struct {
+  uint64_t n;
+  char pad[56];
+} check_loop_counter_t;
+
+static check_loop_counter_t *check_loop_counters = NULL;
+static int check_loop_threads = 0;
+static uint64_t check_loop_total;
+static const char *check_loop_name;
+static double check_loop_start, check_loop_next;
+static double check_loop_interval = -1; // in seconds, 0 for no report
+
+static inline int
+check_loop_thread (void)
+{
+#ifdef _OPENMP
+  return omp_get_thread_num ();
+#else
+  return 0;
+#endif
+}
+
+static inline double
+check_loop_now (void)
+{
+  struct timespec t;
+  clock_gettime (CLOCK_MONOTONIC, &t);
+  return (double) t.tv_sec + 1e-9 * (double) t.tv_nsec;
+}
+
+static void
+check_loop_report (double now)
+{
+  uint64_t done = 0;
+  for (int i = 0; i < check_loop_threads; i++)
+  {
+    uint64_t n;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+    n = check_loop_counters[i].n;
+    done += n;
+  }
+  double t = now - check_loop_start;
+  double rate = (t > 0) ? (double) done / t : 0;
+  fprintf (stderr, "%s: %llu/%llu (%.1f%%), %.3g/s", check_loop_name,
+           (unsigned long long) done, (unsigned long long) check_loop_total,
+           check_loop_total ? 100.0 * (double) done / (double) check_loop_total
+           : 100.0, rate);
+  if (done < check_loop_total && rate > 0)
+  {
+    long eta = (long) ((double) (check_loop_total - done) / rate);
+    fprintf (stderr, ", ETA %ldh%02ldm%02lds", eta / 3600, (eta / 60) % 60,
+             eta % 60);
+  }
+  else
+    fprintf (stderr, ", %.0fs", t);
+  fprintf (stderr, "\n");
+}
+
+static void
+check_loop_begin (uint64_t total, const char *name)
+{
+  if (check_loop_interval < 0)
+  {
+    const char *s = getenv ("CORE_MATH_PROGRESS");
+    check_loop_interval = (s != NULL) ? atof (s) : isatty (2) ? 10 : 0;
+  }
+#ifdef _OPENMP
+  int threads = omp_get_max_threads ();
+#else
+  int threads = 1;
+#endif
+  if (threads > check_loop_threads)
+  {
+    free (check_loop_counters);
+    check_loop_counters = malloc (threads * sizeof (check_loop_counter_t));
+    if (check_loop_counters == NULL)
+    {
+      fprintf (stderr, "Error, cannot allocate the progress counters\n");
+      exit (1);
+    }
+    check_loop_threads = threads;
+  }
+  for (int i = 0; i < check_loop_threads; i++)
+    check_loop_counters[i].n = 0;
+  uint64_t chunk = total / (64 * (uint64_t) threads);
+  check_loop_chunk = (chunk < 1) ? 1
+    : (chunk > CHECK_LOOP_CHUNK) ? CHECK_LOOP_CHUNK : (int) chunk;
+  check_loop_total = total;
+  check_loop_name = name;
+  check_loop_start = check_loop_now ();
+  check_loop_next = check_loop_start + check_loop_interval;
+}
+
+static void
+check_loop_poll (void)
+{
+  double now = check_loop_now (), next;
+#ifdef _OPENMP
+#pragma omp atomic read
+#endif
+  next = check_loop_next;
+  if (now < next)
+    return;
+#ifdef _OPENMP
+#pragma omp critical (check_loop)
+#endif
+  if (now >= check_loop_next)
+  {
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+    check_loop_next = now + check_loop_interval;
+    check_loop_report (now);
+  }
+}
+
+static inline void
+check_loop_step (void)
+{
+  check_loop_counter_t *c = check_loop_counters + check_loop_thread ();
+  // only this thread writes c->n, the atomic write is for the reports
+  uint64_t n = c->n + 1;
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+  c->n = n;
+  if (check_loop_interval > 0 && n % CHECK_LOOP_POLL == 0)
+    check_loop_poll ();
+}
+
+static void
+check_loop_end (void)
+{
+  if (check_loop_interval > 0)
+    check_loop_report (check_loop_now ());
+}
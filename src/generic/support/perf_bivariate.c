@@ -25,6 +25,7 @@ SOFTWARE.
 */
 
 #define _XOPEN_SOURCE 500   /* for ftruncate */
+#define _DEFAULT_SOURCE     /* for syscall */
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -24,6 +24,18 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 SOFTWARE.
 */
 
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "perf_distribution.h"
+
+#ifdef CORE_MATH_STATS
+#include "core-math/stats.h"
+#endif
+
 int rnd1[] = { FE_TONEAREST, FE_TOWARDZERO, FE_UPWARD, FE_DOWNWARD };
 
 int rnd = 0;
@@ -47,13 +59,282 @@ inline uint64_t __rdtsc(void) {
 }
 #endif
 
+/* Timer for --histogram and --evict: each call is timed individually, thus the timer
+   must not let the call be reordered across the reads of the counter. */
+#ifdef __x86_64__
+static inline uint64_t hist_start (void) {
+  _mm_lfence ();
+  uint64_t t = __rdtsc ();
+  _mm_lfence ();
+  return t;
+}
+
+static inline uint64_t hist_stop (void) {
+  unsigned int aux;
+  uint64_t t = __rdtscp (&aux);
+  _mm_lfence ();
+  return t;
+}
+#else
+/* the aarch64 __rdtsc above already starts with an isb */
+static inline uint64_t hist_start (void) { return __rdtsc (); }
+static inline uint64_t hist_stop (void) { return __rdtsc (); }
+#endif
+
+/* --evict <size>: before each call, one byte of every cache line of a buffer
+   of the given size is read and written, which evicts (part of) the tables
+   of the function under test from the caches, as when the calls are
+   interleaved with sweeps over large data.  The buffer is swept in the same
+   order each time, thus a working set smaller than a cache level only
+   evicts part of it. */
+#define CACHE_LINE 64
+
+static void evict (volatile char *buf, size_t size) {
+  for (size_t i = 0; i < size; i += CACHE_LINE)
+    buf[i]++;
+}
+
+/* parse a size with an optional K, M or G suffix (powers of 1024) */
+static size_t parse_size (const char *s) {
+  char *end;
+  double v = strtod (s, &end);
+  switch (*end) {
+  case 'G': case 'g': v *= 1024;
+    /* fall through */
+  case 'M': case 'm': v *= 1024;
+    /* fall through */
+  case 'K': case 'k': v *= 1024;
+  }
+  return (size_t) v;
+}
+
+/* Log-linear histogram of the number of cycles per call: values below
+   HIST_SUB are exact, and each power of 2 above is split into HIST_SUB
+   buckets, thus a bucket is at most 1/HIST_SUB = 6.25% wide. */
+#define HIST_SUB 16
+#define HIST_SUB_BITS 4
+#define HIST_BUCKETS ((64 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+static uint64_t hist[HIST_BUCKETS];
+
+static int hist_bucket (uint64_t t) {
+  if (t < HIST_SUB)
+    return t;
+  int e = 63 - __builtin_clzll (t); /* 2^e <= t < 2^(e+1), e >= HIST_SUB_BITS */
+  return (e - HIST_SUB_BITS + 1) * HIST_SUB
+    + ((t >> (e - HIST_SUB_BITS)) & (HIST_SUB - 1));
+}
+
+/* smallest value falling in bucket b */
+static uint64_t hist_value (int b) {
+  if (b < HIST_SUB)
+    return b;
+  int e = b / HIST_SUB + HIST_SUB_BITS - 1;
+  return (uint64_t) (HIST_SUB + b % HIST_SUB) << (e - HIST_SUB_BITS);
+}
+
+/* Return the smallest bucket value v such that at least a fraction p of the
+   n calls took at most v cycles (up to the bucket width). */
+static uint64_t hist_percentile (uint64_t n, double p) {
+  uint64_t target = (uint64_t) (p * (double) n + 0.5), acc = 0;
+  if (target == 0)
+    target = 1;
+  for (int b = 0; b < HIST_BUCKETS; b++) {
+    acc += hist[b];
+    if (acc >= target)
+      return hist_value (b);
+  }
+  return hist_value (HIST_BUCKETS - 1);
+}
+
+/* Print the percentiles and a histogram with one line per power of 2. */
+static void hist_print (uint64_t n, uint64_t overhead, uint64_t max) {
+  uint64_t octave[65] = {0};
+  for (int b = 0; b < HIST_BUCKETS; b++)
+    if (hist[b]) {
+      uint64_t v = hist_value (b);
+      octave[v ? 64 - __builtin_clzll (v) : 0] += hist[b];
+    }
+  printf ("calls = %lu ; timer overhead = %lu clc (subtracted)\n",
+          (unsigned long) n, (unsigned long) overhead);
+  printf ("p50 = %lu ; p99 = %lu ; p99.9 = %lu ; max = %lu clc/call\n",
+          (unsigned long) hist_percentile (n, 0.5),
+          (unsigned long) hist_percentile (n, 0.99),
+          (unsigned long) hist_percentile (n, 0.999), (unsigned long) max);
+  uint64_t top = 0;
+  int lo = 64, hi = 0;
+  for (int k = 0; k <= 64; k++)
+    if (octave[k]) {
+      top = octave[k] > top ? octave[k] : top;
+      lo = k < lo ? k : lo;
+      hi = k;
+    }
+  for (int k = lo; k <= hi; k++) {
+    /* octave[0] counts the zeros, octave[k] the values in [2^(k-1),2^k) */
+    uint64_t a = k ? 1ull << (k - 1) : 0, b = k ? (1ull << k) - 1 : 0;
+    int w = (int) ((50 * octave[k] + top - 1) / top);
+    printf ("%8lu - %-8lu %10lu %7.3f%% ", (unsigned long) a, (unsigned long) b,
+            (unsigned long) octave[k], 100.0 * (double) octave[k] / (double) n);
+    for (int j = 0; j < w; j++)
+      putchar ('#');
+    putchar ('\n');
+  }
+}
+
+/* Hardware counters read around the timed loop (--json).  Index 0 is the
+   time stamp counter, the others are perf_event_open(2) counters of the
+   calling thread (user space only); a counter that cannot be opened or was
+   never scheduled is reported as null. */
+#define NEVENTS 6
+
+static const char *event_names[NEVENTS] =
+  { "rdtsc", "cycles", "instructions", "branch-misses", "l1d-misses",
+    "uops" };
+
+static int event_fd[NEVENTS] = { -1, -1, -1, -1, -1, -1 };
+
+/* uops_event is a raw event code, since there is no generic event counting
+   micro-operations: the default 0x010e is UOPS_ISSUED.ANY on Intel
+   processors, on AMD processors one can use 0x00c1 (retired ops). */
+static void counters_open (uint64_t uops_event) {
+#ifdef __linux__
+  const struct { uint32_t type; uint64_t config; } ev[NEVENTS] = {
+    { 0, 0 },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+      | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+      | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_RAW, uops_event },
+  };
+  for (int e = 1; e < NEVENTS; e++) {
+    struct perf_event_attr attr;
+    memset (&attr, 0, sizeof (attr));
+    attr.size = sizeof (attr);
+    attr.type = ev[e].type;
+    attr.config = ev[e].config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    event_fd[e] = syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+#else
+  (void) uops_event;
+#endif
+}
+
+static void counters_start (void) {
+#ifdef __linux__
+  for (int e = 1; e < NEVENTS; e++)
+    if (event_fd[e] >= 0) {
+      ioctl (event_fd[e], PERF_EVENT_IOC_RESET, 0);
+      ioctl (event_fd[e], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+}
+
+/* Store the counts into v[1..NEVENTS-1], scaled up when the kernel had to
+   multiplex the counters. */
+static void counters_stop (double *v) {
+  for (int e = 1; e < NEVENTS; e++)
+    v[e] = NAN;
+#ifdef __linux__
+  for (int e = 1; e < NEVENTS; e++)
+    if (event_fd[e] >= 0)
+      ioctl (event_fd[e], PERF_EVENT_IOC_DISABLE, 0);
+  for (int e = 1; e < NEVENTS; e++) {
+    uint64_t buf[3]; /* value, time enabled, time running */
+    if (event_fd[e] >= 0 && read (event_fd[e], buf, sizeof (buf)) == sizeof (buf)
+        && buf[2] != 0)
+      v[e] = (double) buf[0] * ((double) buf[1] / (double) buf[2]);
+  }
+#endif
+}
+
+/* --worst: the inputs are the entries of the .wc file, and the calls are
+   split according to the path they took, as counted by the function itself
+   when it was built with CORE_MATH_STATS (otherwise, or with --libc, only
+   the total is known).  path[0] is for the calls which returned from the
+   fast path (or a special case), path[1] for those which fell through to
+   the accurate path. */
+static void worst_print (uint64_t n, uint64_t overhead, int split,
+                         const uint64_t *calls, const uint64_t *sum) {
+  printf ("calls = %lu ; timer overhead = %lu clc (subtracted)\n",
+          (unsigned long) n, (unsigned long) overhead);
+  if (split) {
+    printf ("fell through = %lu (%.3f%%)\n", (unsigned long) calls[1],
+            100.0 * (double) calls[1] / (double) n);
+    for (int k = 0; k < 2; k++) {
+      printf (k ? "accurate path = " : "fast path = ");
+      if (calls[k])
+        printf ("%.3f clc/call ; ", (double) sum[k] / (double) calls[k]);
+      else
+        printf ("none ; ");
+    }
+  } else
+    printf ("fell through = unknown (no counters)\n");
+  printf ("all = %.3f clc/call\n", (double) (sum[0] + sum[1]) / (double) n);
+}
+
+static int cmp_double (const void *a, const void *b) {
+  double x = *(const double *) a, y = *(const double *) b;
+  return (x > y) - (x < y);
+}
+
+static void json_value (double x) {
+  if (isnan (x))
+    printf ("null");
+  else
+    printf ("%.3f", x);
+}
+
+/* Print the counts per call of all the trials, and their minimum and median,
+   as one JSON object. */
+static void json_print (const char *implementation, int latency, long calls,
+                        int trials, double (*res)[NEVENTS]) {
+  printf ("{\"function\": \"%s\", \"implementation\": \"%s\", "
+          "\"mode\": \"%s\", \"calls_per_trial\": %ld, \"trials\": [",
+          DIST_XSTR(function_under_test), implementation,
+          latency ? "latency" : "throughput", calls);
+  for (int t = 0; t < trials; t++) {
+    printf (t ? ", {" : "{");
+    for (int e = 0; e < NEVENTS; e++) {
+      printf (e ? ", \"%s\": " : "\"%s\": ", event_names[e]);
+      json_value (res[t][e]);
+    }
+    printf ("}");
+  }
+  printf ("]");
+  double *col = malloc (trials * sizeof (double));
+  for (int s = 0; s < 2; s++) {
+    printf (s ? ", \"median\": {" : ", \"min\": {");
+    for (int e = 0; e < NEVENTS; e++) {
+      for (int t = 0; t < trials; t++)
+        col[t] = res[t][e];
+      qsort (col, trials, sizeof (double), cmp_double);
+      printf (e ? ", \"%s\": " : "\"%s\": ", event_names[e]);
+      /* NaNs are all or nothing for a given event */
+      json_value (s ? col[trials / 2] : col[0]);
+    }
+    printf ("}");
+  }
+  printf ("}\n");
+  free (col);
+}
+
 int
 main (int argc, char *argv[])
 {
   int count = 1000000, repeat = 1;
-  int reference = 0, latency = 0, show_rdtsc = 0;
+  int reference = 0, latency = 0, show_rdtsc = 0, histogram = 0, worst = 0;
+  int trials = 1, json = 0;
+  size_t evict_size = 0;
+  uint64_t uops_event = 0x010e;
   function_type_under_test *p_function_under_test = &cr_function_under_test;
-  char *file = NULL;
+  char *file = NULL, *distribution = NULL;
 
   while (argc >= 2)
     {
@@ -93,6 +374,48 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--histogram") == 0)
+        {
+          histogram = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--worst") == 0)
+        {
+          worst = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--evict") == 0)
+        {
+          argc --;
+          argv ++;
+          evict_size = parse_size(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--json") == 0)
+        {
+          json = 1;
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--trials") == 0)
+        {
+          argc --;
+          argv ++;
+          trials = atoi(argv[1]);
+          argc --;
+          argv ++;
+        }
+      else if (strcmp (argv[1], "--uops-event") == 0)
+        {
+          argc --;
+          argv ++;
+          uops_event = strtoull(argv[1], NULL, 0);
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--rdtsc") == 0)
         {
           show_rdtsc = 1;
@@ -113,6 +436,14 @@ main (int argc, char *argv[])
           argc --;
           argv ++;
         }
+      else if (strcmp (argv[1], "--distribution") == 0)
+        {
+          argc --;
+          argv ++;
+          distribution = argv[1];
+          argc --;
+          argv ++;
+        }
       else if (strcmp (argv[1], "--count") == 0)
         {
           argc --;
@@ -158,9 +489,8 @@ main (int argc, char *argv[])
       perror("mmap");
       exit(3);
     }
-    for (unsigned int i = 0; i < count * SAMPLE_SIZE / sizeof(TYPE_UNDER_TEST); i++) {
-      randoms[i] = random_under_test();
-    }
+    dist_fill(randoms, count, distribution == NULL && worst ? "near-worst"
+              : distribution);
     msync(randoms, count * SAMPLE_SIZE, MS_SYNC);
     munmap(randoms, count * SAMPLE_SIZE);
     close(fd);
@@ -181,25 +511,109 @@ main (int argc, char *argv[])
       exit(3);
     }
     memcpy(randoms, mmaped_randoms, count * SAMPLE_SIZE);
-    uint64_t start = __rdtsc();
-    if (latency) {
-      for (int r = 0; r < repeat; r++) {
-        TYPE_UNDER_TEST accu = 0;
-        for (int i = 0; i < count; i++) {
-          accu = CALL_LATENCY(i);
+    if (histogram || evict_size || worst) {
+      /* calibrate the cost of an empty timed region */
+      uint64_t overhead = UINT64_MAX, max = 0, sum = 0;
+      for (int i = 0; i < 100000; i++) {
+        uint64_t t0 = hist_start();
+        uint64_t t1 = hist_stop();
+        if (t1 - t0 < overhead)
+          overhead = t1 - t0;
+      }
+      char *buf = NULL;
+      if (evict_size) {
+        buf = calloc(evict_size, 1);
+        if (buf == NULL) {
+          perror("calloc");
+          exit(3);
         }
       }
-    } else {
+      volatile TYPE_UNDER_TEST sink;
+      uint64_t path_calls[2] = {0, 0}, path_sum[2] = {0, 0};
+      int split = 0;
+#ifdef CR_STATS_FUNCTION_UNDER_TEST
+      split = p_function_under_test == &cr_function_under_test;
+      cr_stats_t s0, s1;
+      cr_stats_get(CR_STATS_FUNCTION_UNDER_TEST, &s0);
+#endif
       for (int r = 0; r < repeat; r++) {
         for (int i = 0; i < count; i++) {
-          CALL_THROUGHPUT(i);
+          if (buf)
+            evict(buf, evict_size);
+          uint64_t t0 = hist_start();
+          sink = CALL_THROUGHPUT(i);
+          uint64_t t1 = hist_stop();
+          uint64_t t = t1 - t0 > overhead ? t1 - t0 - overhead : 0;
+          int path = 0;
+#ifdef CR_STATS_FUNCTION_UNDER_TEST
+          /* read outside of the timed region */
+          cr_stats_get(CR_STATS_FUNCTION_UNDER_TEST, &s1);
+          path = s1.accurate != s0.accurate;
+          s0 = s1;
+#endif
+          path_calls[path]++;
+          path_sum[path] += t;
+          hist[hist_bucket(t)]++;
+          sum += t;
+          if (t > max)
+            max = t;
         }
       }
+      (void) sink;
+      free(buf);
+      if (worst)
+        worst_print((uint64_t) repeat * count, overhead, split, path_calls,
+                    path_sum);
+      if (histogram)
+        hist_print((uint64_t) repeat * count, overhead, max);
+      else if (!worst)
+        /* same format as --rdtsc */
+        printf("%.3f\n", (double) sum / ((double) repeat * count));
+      munmap(mmaped_randoms, count * SAMPLE_SIZE);
+      close(fd);
+      return 0;
     }
-    uint64_t stop = __rdtsc();
-    if (show_rdtsc) {
-      printf("%.3f\n", (double) (stop - start) / (repeat * count));
+    if (trials < 1)
+      trials = 1;
+    double (*res)[NEVENTS] = malloc(trials * sizeof(*res));
+    if (res == NULL) {
+      perror("malloc");
+      exit(3);
+    }
+    if (json)
+      counters_open(uops_event);
+    /* all the trials run in this process, on the same inputs */
+    for (int t = 0; t < trials; t++) {
+      counters_start();
+      uint64_t start = __rdtsc();
+      if (latency) {
+        for (int r = 0; r < repeat; r++) {
+          TYPE_UNDER_TEST accu = 0;
+          for (int i = 0; i < count; i++) {
+            accu = CALL_LATENCY(i);
+          }
+        }
+      } else {
+        for (int r = 0; r < repeat; r++) {
+          for (int i = 0; i < count; i++) {
+            CALL_THROUGHPUT(i);
+          }
+        }
+      }
+      uint64_t stop = __rdtsc();
+      counters_stop(res[t]);
+      res[t][0] = stop - start;
+      for (int e = 0; e < NEVENTS; e++)
+        res[t][e] /= (double) repeat * count;
+      if (show_rdtsc && !json) {
+        printf("%.3f\n", res[t][0]);
+      }
     }
+    if (json)
+      json_print(p_function_under_test == &cr_function_under_test
+                 ? "core-math" : "libc", latency, (long) repeat * count,
+                 trials, res);
+    free(res);
     munmap(mmaped_randoms, count * sizeof(TYPE_UNDER_TEST));
     close(fd);
   }
@@ -0,0 +1,311 @@
+/* Input distributions for the performance tests.
+
+Copyright (c) 2022 Stéphane Glondu, Inria.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* The argument of --distribution selects how ./perf --reference draws the
+   arguments of the function under test:
+
+   default           random_under_test() from src/generic/<function>
+   uniform:a:b       uniform in [a,b]
+   log-uniform:a:b   uniform exponent and uniform significand in [a,b]
+                     (a bound 0 stands for the smallest subnormal)
+   gaussian:mu:sigma normal with mean mu and standard deviation sigma
+   huge[:a]          |x| log-uniform in [a,max] (default a = 2^20), random sign
+   subnormal         uniform among the subnormals, random sign
+   near-worst[:k]    entries of the <function>.wc file of the current
+                     directory, moved by up to k ulps (default 0)
+   trace:file        arguments read from a binary file in the format of
+                     --file (native TYPE_UNDER_TEST values), repeated if needed
+
+   For bivariate functions, uniform, log-uniform, gaussian, huge and subnormal
+   can be given per argument, separated by a comma (uniform:0:10,uniform:-5:5);
+   a single one applies to both arguments. */
+
+#include <float.h>
+#include <math.h>
+
+#define DIST_ARITY ((int) (SAMPLE_SIZE / sizeof (TYPE_UNDER_TEST)))
+
+#define DIST_MANT_DIG _Generic ((TYPE_UNDER_TEST) 0, float: FLT_MANT_DIG, \
+  double: DBL_MANT_DIG, default: LDBL_MANT_DIG)
+#define DIST_MIN_EXP _Generic ((TYPE_UNDER_TEST) 0, float: FLT_MIN_EXP, \
+  double: DBL_MIN_EXP, default: LDBL_MIN_EXP)
+#define DIST_MAX _Generic ((TYPE_UNDER_TEST) 0, float: FLT_MAX, \
+  double: DBL_MAX, default: LDBL_MAX)
+#define DIST_NEXTAFTER(x, y) _Generic ((TYPE_UNDER_TEST) 0, \
+  float: nextafterf, double: nextafter, default: nextafterl) (x, y)
+
+#define DIST_STR(x) #x
+#define DIST_XSTR(x) DIST_STR(x)
+
+enum { DIST_DEFAULT, DIST_UNIFORM, DIST_LOG_UNIFORM, DIST_GAUSSIAN, DIST_HUGE,
+       DIST_SUBNORMAL, DIST_NEAR_WORST, DIST_TRACE };
+
+typedef struct {
+  int kind;
+  long double a, b;
+} dist_param_t;
+
+static uint64_t dist_state = 0x2545f4914f6cdd1dull;
+
+/* xorshift64*, enough for drawing inputs */
+static uint64_t dist_rand64 (void) {
+  dist_state ^= dist_state >> 12;
+  dist_state ^= dist_state << 25;
+  dist_state ^= dist_state >> 27;
+  return dist_state * 0x2545f4914f6cdd1dull;
+}
+
+/* uniform in [0,1) */
+static long double dist_unit (void) {
+  return (long double) (dist_rand64 () >> 11) * 0x1p-53L;
+}
+
+static TYPE_UNDER_TEST dist_random_sign (long double x) {
+  return (TYPE_UNDER_TEST) ((dist_rand64 () >> 63) ? -x : x);
+}
+
+static long double dist_true_min (void) {
+  return ldexpl (1.0L, DIST_MIN_EXP - DIST_MANT_DIG);
+}
+
+/* |x| in [lo,hi] with 0 <= lo <= hi: the exponent is drawn uniformly, then
+   the significand, with all its bits random */
+static TYPE_UNDER_TEST dist_log_magnitude (long double lo, long double hi) {
+  if (lo == 0)
+    lo = dist_true_min ();
+  int elo = ilogbl (lo), ehi = ilogbl (hi);
+  for (int tries = 0; tries < 1000; tries++) {
+    int e = elo + (int) (dist_unit () * (ehi - elo + 1));
+    long double m = 1.0L + (long double) dist_rand64 () * 0x1p-64L;
+    TYPE_UNDER_TEST x = (TYPE_UNDER_TEST) ldexpl (m, e);
+    if (lo <= x && x <= hi)
+      return x;
+  }
+  /* [lo,hi] is a tiny part of its binades: fall back to uniform */
+  return (TYPE_UNDER_TEST) (lo + (hi - lo) * dist_unit ());
+}
+
+static TYPE_UNDER_TEST dist_log_uniform (long double a, long double b) {
+  if (a >= 0)
+    return dist_log_magnitude (a, b);
+  if (b <= 0)
+    return -dist_log_magnitude (-b, -a);
+  return (dist_rand64 () >> 63) ? -dist_log_magnitude (0, -a)
+    : dist_log_magnitude (0, b);
+}
+
+static TYPE_UNDER_TEST dist_gaussian (long double mu, long double sigma) {
+  /* Box-Muller */
+  double u = 1.0 - (double) dist_unit (), v = (double) dist_unit ();
+  double z = sqrt (-2.0 * log (u)) * cos (0x1.921fb54442d18p+2 * v);
+  return (TYPE_UNDER_TEST) (mu + sigma * z);
+}
+
+static TYPE_UNDER_TEST dist_subnormal (void) {
+  /* the subnormals are the k * true_min with 0 <= k < 2^(p-1) */
+  uint64_t k = dist_rand64 () >> (64 - (DIST_MANT_DIG - 1));
+  return dist_random_sign ((long double) k * dist_true_min ());
+}
+
+static TYPE_UNDER_TEST dist_draw (const dist_param_t *d) {
+  switch (d->kind) {
+  case DIST_UNIFORM:
+    return (TYPE_UNDER_TEST) (d->a + (d->b - d->a) * dist_unit ());
+  case DIST_LOG_UNIFORM:
+    return dist_log_uniform (d->a, d->b);
+  case DIST_GAUSSIAN:
+    return dist_gaussian (d->a, d->b);
+  case DIST_HUGE:
+    return dist_random_sign (dist_log_magnitude (d->a, DIST_MAX));
+  case DIST_SUBNORMAL:
+    return dist_subnormal ();
+  default:
+    return random_under_test ();
+  }
+}
+
+static void dist_error (const char *spec, const char *msg) {
+  fprintf (stderr, "Error, invalid distribution %s: %s\n", spec, msg);
+  exit (1);
+}
+
+/* parse one component of the --distribution argument into d, and return the
+   position after it */
+static const char *dist_parse (const char *spec, const char *s,
+                               dist_param_t *d) {
+  static const struct { const char *name; int kind, nparams; } names[] = {
+    {"default", DIST_DEFAULT, 0}, {"uniform", DIST_UNIFORM, 2},
+    {"log-uniform", DIST_LOG_UNIFORM, 2}, {"gaussian", DIST_GAUSSIAN, 2},
+    {"huge", DIST_HUGE, -1}, {"subnormal", DIST_SUBNORMAL, 0},
+    {"near-worst", DIST_NEAR_WORST, -1}, {"trace", DIST_TRACE, 0},
+  };
+  size_t len = strcspn (s, ":,");
+  int k = -1;
+  for (unsigned int i = 0; i < sizeof (names) / sizeof (names[0]); i++)
+    if (strlen (names[i].name) == len && strncmp (s, names[i].name, len) == 0)
+      k = i;
+  if (k < 0)
+    dist_error (spec, "unknown distribution");
+  d->kind = names[k].kind;
+  s += len;
+  if (d->kind == DIST_TRACE) {
+    /* the rest is the file name */
+    if (*s != ':' || s[1] == 0)
+      dist_error (spec, "trace needs a file");
+    return s + 1;
+  }
+  long double p[2] = {0, 0};
+  int n = 0;
+  while (*s == ':' && n < 2) {
+    char *end;
+    p[n++] = strtold (s + 1, &end);
+    if (end == s + 1)
+      dist_error (spec, "invalid parameter");
+    s = end;
+  }
+  if (names[k].nparams >= 0 ? n != names[k].nparams : n > 1)
+    dist_error (spec, "wrong number of parameters");
+  if (d->kind == DIST_UNIFORM || d->kind == DIST_LOG_UNIFORM) {
+    if (!(p[0] <= p[1]))
+      dist_error (spec, "empty interval");
+  }
+  if (d->kind == DIST_HUGE && n == 0)
+    p[0] = 0x1p20L;
+  if (d->kind == DIST_HUGE && !(p[0] > 0))
+    dist_error (spec, "the lower bound must be positive");
+  d->a = p[0];
+  d->b = p[1];
+  return s;
+}
+
+/* Read the entries of a .wc file (one or two values per line, separated by a
+   comma; comments and unparsable lines such as sNaNs are skipped).  Return
+   the number of entries, stored DIST_ARITY values each into *out. */
+static int dist_read_wc (const char *file, TYPE_UNDER_TEST **out) {
+  FILE *f = fopen (file, "r");
+  if (f == NULL) {
+    perror (file);
+    exit (3);
+  }
+  int n = 0, size = 1024;
+  TYPE_UNDER_TEST *v = malloc (size * SAMPLE_SIZE);
+  char line[256];
+  while (fgets (line, sizeof (line), f)) {
+    TYPE_UNDER_TEST t[2];
+    char *s = line, *end;
+    int k;
+    for (k = 0; k < DIST_ARITY; k++) {
+      if (k && *s++ != ',')
+        break;
+      t[k] = (TYPE_UNDER_TEST) strtold (s, &end);
+      if (end == s)
+        break;
+      s = end;
+    }
+    if (k < DIST_ARITY || strspn (s, " \t\r\n") != strlen (s))
+      continue;
+    if (n == size) {
+      size *= 2;
+      v = realloc (v, size * SAMPLE_SIZE);
+    }
+    if (v == NULL) {
+      perror ("realloc");
+      exit (3);
+    }
+    memcpy (v + n * DIST_ARITY, t, SAMPLE_SIZE);
+    n++;
+  }
+  fclose (f);
+  if (n == 0) {
+    fprintf (stderr, "Error, no entry in %s\n", file);
+    exit (3);
+  }
+  *out = v;
+  return n;
+}
+
+/* Fill randoms with count samples of DIST_ARITY arguments each, drawn
+   according to spec (NULL means default). */
+static void dist_fill (TYPE_UNDER_TEST *randoms, int count, const char *spec) {
+  dist_param_t d[2];
+  if (spec == NULL)
+    spec = "default";
+  const char *s = dist_parse (spec, spec, &d[0]);
+  d[1] = d[0];
+  if (d[0].kind != DIST_TRACE) {
+    /* near-worst and trace give all the arguments */
+    if (*s == ',' && d[0].kind != DIST_NEAR_WORST && DIST_ARITY == 2) {
+      s = dist_parse (spec, s + 1, &d[1]);
+      if (d[1].kind == DIST_TRACE || d[1].kind == DIST_NEAR_WORST)
+        dist_error (spec, "near-worst and trace apply to all arguments");
+    }
+    if (*s != 0)
+      dist_error (spec, "unexpected trailing characters");
+  }
+
+  long total = (long) count * DIST_ARITY;
+  if (d[0].kind == DIST_TRACE) {
+    int fd = open (s, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat (fd, &st) < 0) {
+      perror (s);
+      exit (3);
+    }
+    long n = st.st_size / SAMPLE_SIZE;
+    if (n == 0)
+      dist_error (spec, "empty trace");
+    TYPE_UNDER_TEST *trace = malloc (n * SAMPLE_SIZE);
+    if (trace == NULL || read (fd, trace, n * SAMPLE_SIZE) != (ssize_t) (n * SAMPLE_SIZE)) {
+      perror (s);
+      exit (3);
+    }
+    close (fd);
+    for (long i = 0; i < count; i++)
+      memcpy (randoms + i * DIST_ARITY, trace + (i % n) * DIST_ARITY,
+              SAMPLE_SIZE);
+    free (trace);
+  } else if (d[0].kind == DIST_NEAR_WORST) {
+    TYPE_UNDER_TEST *wc;
+    int n = dist_read_wc (DIST_XSTR(function_under_test) ".wc", &wc);
+    int ulps = (int) d[0].a;
+    for (long i = 0; i < total; i += DIST_ARITY) {
+      const TYPE_UNDER_TEST *t = wc + (dist_rand64 () % n) * DIST_ARITY;
+      for (int k = 0; k < DIST_ARITY; k++) {
+        TYPE_UNDER_TEST x = t[k];
+        int m = ulps ? (int) (dist_rand64 () % (2 * ulps + 1)) - ulps : 0;
+        for (; m > 0; m--)
+          x = DIST_NEXTAFTER (x, (TYPE_UNDER_TEST) INFINITY);
+        for (; m < 0; m++)
+          x = DIST_NEXTAFTER (x, -(TYPE_UNDER_TEST) INFINITY);
+        randoms[i + k] = x;
+      }
+    }
+    free (wc);
+  } else {
+    for (long i = 0; i < total; i++)
+      randoms[i] = dist_draw (&d[i % DIST_ARITY]);
+  }
+}
@@ -0,0 +1,52 @@
+/* Per-thread counters of the paths taken by the functions of the library.
+
+This file is part of the CORE-MATH project
+(https://core-math.gitlabpages.inria.fr/).
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/* This file is compiled once, also on x86-64, so that all the variants of
+   a function update the same counters.  The counters are defined even when
+   CORE_MATH_STATS is not, so that programs using core-math/stats.h link
+   against any build of the library. */
+
+#include "core-math/stats.h"
+
+thread_local constinit cr_stats_counters_t
+  cr_stats_counters[CR_STATS_FUNCTIONS] = {};
+
+void __cdecl
+cr_stats_get (enum cr_stats_function f, cr_stats_t *s)
+{
+  const cr_stats_counters_t *c = &cr_stats_counters[f];
+  s->fast = c->fast;
+  s->accurate = c->accurate;
+  s->database = c->database;
+  // every call returns through exactly one of the fast path, the accurate
+  // path or a special exit
+  s->special = c->calls - c->fast - c->accurate;
+}
+
+void __cdecl
+cr_stats_reset (void)
+{
+  for (int f = 0; f < CR_STATS_FUNCTIONS; f++)
+    cr_stats_counters[f] = {};
+}